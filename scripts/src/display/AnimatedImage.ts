@@ -0,0 +1,97 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * AnimatedImage draws an animated GIF or WebP image. Only the encoded data is kept, each frame is decoded the first
+ * time it is drawn, and the decoded frames are kept in a cache shared by all animated images that discards the least
+ * recently drawn frames once it is over budget. A playing image shows the frame of the current animation frame
+ * timestamp, so it animates as long as frames are requested. It can be drawn wherever an Image can.
+ */
+interface AnimatedImage {
+    /**
+     * The width of the image in pixels.
+     */
+    readonly width:number;
+
+    /**
+     * The height of the image in pixels.
+     */
+    readonly height:number;
+
+    /**
+     * The number of frames of the animation, 1 for a still image.
+     */
+    readonly frameCount:number;
+
+    /**
+     * The index of the frame being shown.
+     */
+    readonly currentFrame:number;
+
+    /**
+     * Indicates whether the frames advance with time. Animations loop forever. The default value is true.
+     */
+    readonly playing:boolean;
+
+    /**
+     * Starts advancing the frames from the current frame.
+     */
+    play():void;
+
+    /**
+     * Stops advancing the frames, the current frame keeps being shown.
+     */
+    stop():void;
+
+    /**
+     * Shows the frame at the specified index. A playing image continues from that frame.
+     */
+    gotoFrame(index:number):void;
+
+    /**
+     * Immediately frees the encoded data and the cached frames of the image. The AnimatedImage object is no longer
+     * usable afterwards.
+     */
+    dispose():void;
+}
+
+declare let AnimatedImage:{
+    prototype:AnimatedImage;
+    /**
+     * Creates an AnimatedImage object from encoded image data, for example the result of cyder.readFileMapped(). The
+     * data is copied. Throws a TypeError if the data is not a supported image.
+     */
+    new(data:ArrayBuffer):AnimatedImage;
+    /**
+     * Sets the budget, in bytes, of the cache holding the decoded frames of all animated images. The default value is
+     * 32MB.
+     */
+    setFrameCacheLimit(bytes:number):void;
+    /**
+     * Returns the number of bytes currently used by the cache holding the decoded frames.
+     */
+    getFrameCacheUsage():number;
+}
@@ -39,6 +39,12 @@ interface Canvas {
      */
     width:number;
 
+    /**
+     * Changes the width and the height of the render at once and clears its content. Setting the width and the height
+     * separately may reallocate the pixels twice. When the render shrinks, its existing pixel memory is reused.
+     */
+    resize(width:number, height:number):void;
+
     /**
      * Returns a drawing context on the render, or null if the context identifier is not supported.
      * @param contextType A string containing the context identifier defining the drawing context associated to the render.
@@ -52,6 +58,13 @@ interface Canvas {
      * will not be reflected in this image.
      */
     makeImageSnapshot():Image;
+
+    /**
+     * Returns the bounds of the area of the canvas that has changed since its content was last presented, in pixels.
+     * The content of a window canvas is presented at the end of each frame, and the content of an off-screen canvas
+     * is presented by makeImageSnapshot().
+     */
+    getDamageRect():Rectangle;
 }
 
 declare let Canvas:{
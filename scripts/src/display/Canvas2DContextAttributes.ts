@@ -40,4 +40,27 @@ interface Canvas2DContextAttributes {
      * @default false
      */
     willReadFrequently?:boolean;
+    /**
+     * A boolean value that indicates whether the drawing commands are recorded into a display list instead of being
+     * rasterized immediately. The recorded commands are played back into the render once at the end of each frame, or
+     * when the content of the render is requested, e.g. by makeImageSnapshot().
+     * @default false
+     */
+    deferred?:boolean;
+    /**
+     * A boolean value that indicates whether a software render is rasterized in tiles on all the CPU cores. The drawing
+     * commands are recorded and rasterized in parallel before the pixels are used, e.g. by makeImageSnapshot(), or at
+     * the end of the frame. It only applies to software renders, such as the ones created with willReadFrequently, and
+     * images taken from hardware accelerated renders must not be drawn into it.
+     * @default false
+     */
+    tiledRaster?:boolean;
+    /**
+     * The format of the pixels of the render. "rgb565" halves the memory of the default "rgba8888" and is always
+     * opaque. "alpha8" only keeps the coverage of what is drawn, one byte per pixel, and its snapshots are drawn filled
+     * with the current fillStyle like a mask. Both force a software render. "gray8" is not supported for renders and
+     * gives "rgba8888".
+     * @default "rgba8888"
+     */
+    colorType?:"rgba8888" | "rgb565" | "alpha8" | "gray8";
 }
\ No newline at end of file
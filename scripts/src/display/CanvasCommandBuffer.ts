@@ -0,0 +1,292 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The CanvasCommandBuffer class records 2d drawing calls into a typed array and executes the whole batch on its
+ * CanvasRenderingContext2D with one native call. It is much faster than calling the context for each draw when many
+ * small shapes or sprites are drawn every frame. The recorded commands are executed by flush(), when the buffer is
+ * full, or automatically at the end of the frame.<br/>
+ * Properties of the context that are not recorded, such as font or globalCompositeOperation, must be set through the
+ * setters of this class, which flush the pending commands first to keep the drawing order.
+ */
+class CanvasCommandBuffer {
+    /**
+     * Creates a command buffer for a 2d context.
+     * @param context The context to execute the commands on.
+     * @param capacity The number of 32-bit words the buffer can hold before it flushes automatically.
+     */
+    public constructor(context:CanvasRenderingContext2D, capacity:number = 16384) {
+        this.context = context;
+        this.buffer = new ArrayBuffer(capacity * 4);
+        this.words = new Uint32Array(this.buffer);
+        this.floats = new Float32Array(this.buffer);
+        this.capacity = capacity;
+        let self = this;
+        this.flushCallback = function ():void {
+            self.scheduled = false;
+            self.flush();
+        };
+    }
+
+    /**
+     * The context the commands are executed on.
+     */
+    public readonly context:CanvasRenderingContext2D;
+
+    private buffer:ArrayBuffer;
+    private words:Uint32Array;
+    private floats:Float32Array;
+    private capacity:number;
+    private length:number = 0;
+    private images:CanvasImageSource[] = [];
+    private scheduled:boolean = false;
+    private flushCallback:() => void;
+
+    /**
+     * Executes all the recorded commands on the context.
+     */
+    public flush():void {
+        if (this.length == 0) {
+            return;
+        }
+        let length = this.length;
+        let images = this.images;
+        this.length = 0;
+        this.images = [];
+        this.context.executeCommands(this.buffer, length, images);
+    }
+
+    /**
+     * Reserves words for a command and returns the position of its first operand.
+     */
+    private begin(opcode:number, operandCount:number):number {
+        let size = operandCount + 1;
+        if (size > this.capacity) {
+            throw new RangeError("The command buffer is too small.");
+        }
+        if (this.length + size > this.capacity) {
+            this.flush();
+        }
+        if (!this.scheduled) {
+            this.scheduled = true;
+            cyder.callAtFrameEnd(this.flushCallback);
+        }
+        let position = this.length;
+        this.words[position] = opcode;
+        this.length += size;
+        return position + 1;
+    }
+
+    private writeFloats(opcode:number, a?:number, b?:number, c?:number, d?:number, e?:number, f?:number):void {
+        let count = arguments.length - 1;
+        let position = this.begin(opcode, count);
+        let floats = this.floats;
+        for (let i = 0; i < count; i++) {
+            floats[position + i] = arguments[i + 1];
+        }
+    }
+
+    public save():void {
+        this.begin(0, 0);
+    }
+
+    public restore():void {
+        this.begin(1, 0);
+    }
+
+    public setTransform(a:number, b:number, c:number, d:number, e:number, f:number):void {
+        this.writeFloats(2, a, b, c, d, e, f);
+    }
+
+    public transform(a:number, b:number, c:number, d:number, e:number, f:number):void {
+        this.writeFloats(3, a, b, c, d, e, f);
+    }
+
+    public translate(x:number, y:number):void {
+        this.writeFloats(4, x, y);
+    }
+
+    public rotate(angle:number):void {
+        this.writeFloats(5, angle);
+    }
+
+    public scale(x:number, y:number):void {
+        this.writeFloats(6, x, y);
+    }
+
+    public set globalAlpha(value:number) {
+        this.writeFloats(7, value);
+    }
+
+    /**
+     * Sets the fill style. A number is an ARGB color (0xAARRGGBB) and is recorded, a string is a CSS color and is set
+     * on the context after flushing the pending commands.
+     */
+    public set fillStyle(value:number|string) {
+        if (typeof value == "number") {
+            let position = this.begin(8, 1);
+            this.words[position] = value;
+        } else {
+            this.flush();
+            this.context.fillStyle = value;
+        }
+    }
+
+    /**
+     * Sets the stroke style. A number is an ARGB color (0xAARRGGBB) and is recorded, a string is a CSS color and is
+     * set on the context after flushing the pending commands.
+     */
+    public set strokeStyle(value:number|string) {
+        if (typeof value == "number") {
+            let position = this.begin(9, 1);
+            this.words[position] = value;
+        } else {
+            this.flush();
+            this.context.strokeStyle = value;
+        }
+    }
+
+    public set lineWidth(value:number) {
+        this.writeFloats(10, value);
+    }
+
+    public set font(value:string) {
+        this.flush();
+        this.context.font = value;
+    }
+
+    public set globalCompositeOperation(value:string) {
+        this.flush();
+        this.context.globalCompositeOperation = value;
+    }
+
+    public beginPath():void {
+        this.begin(11, 0);
+    }
+
+    public closePath():void {
+        this.begin(12, 0);
+    }
+
+    public moveTo(x:number, y:number):void {
+        this.writeFloats(13, x, y);
+    }
+
+    public lineTo(x:number, y:number):void {
+        this.writeFloats(14, x, y);
+    }
+
+    public quadraticCurveTo(cpx:number, cpy:number, x:number, y:number):void {
+        this.writeFloats(15, cpx, cpy, x, y);
+    }
+
+    public bezierCurveTo(cp1x:number, cp1y:number, cp2x:number, cp2y:number, x:number, y:number):void {
+        this.writeFloats(16, cp1x, cp1y, cp2x, cp2y, x, y);
+    }
+
+    public arc(x:number, y:number, radius:number, startAngle:number, endAngle:number, anticlockwise?:boolean):void {
+        if (radius < 0) {
+            throw new RangeError("IndexSizeError: The radius provided is negative.");
+        }
+        let position = this.begin(17, 6);
+        let floats = this.floats;
+        floats[position] = x;
+        floats[position + 1] = y;
+        floats[position + 2] = radius;
+        floats[position + 3] = startAngle;
+        floats[position + 4] = endAngle;
+        this.words[position + 5] = anticlockwise ? 1 : 0;
+    }
+
+    public rect(x:number, y:number, width:number, height:number):void {
+        this.writeFloats(18, x, y, width, height);
+    }
+
+    /**
+     * Fills the current path of the context.
+     * @param fillRule Either "nonzero" or "evenodd".
+     */
+    public fill(fillRule?:string):void {
+        let position = this.begin(19, 1);
+        this.words[position] = fillRule == "evenodd" ? 1 : 0;
+    }
+
+    public stroke():void {
+        this.begin(20, 0);
+    }
+
+    public fillRect(x:number, y:number, width:number, height:number):void {
+        this.writeFloats(21, x, y, width, height);
+    }
+
+    public strokeRect(x:number, y:number, width:number, height:number):void {
+        this.writeFloats(22, x, y, width, height);
+    }
+
+    public clearRect(x:number, y:number, width:number, height:number):void {
+        this.writeFloats(23, x, y, width, height);
+    }
+
+    /**
+     * Draws an image onto the canvas, with the same arguments as CanvasRenderingContext2D.drawImage().
+     */
+    public drawImage(image:CanvasImageSource, targetX:number, targetY:number):void;
+    public drawImage(image:CanvasImageSource, targetX:number, targetY:number, targetWidth:number,
+                     targetHeight:number):void;
+    public drawImage(image:CanvasImageSource, sourceX:number, sourceY:number, sourceWidth:number,
+                     sourceHeight:number, targetX:number, targetY:number, targetWidth:number,
+                     targetHeight:number):void;
+    public drawImage(image:CanvasImageSource, a:number, b:number, c?:number, d?:number, e?:number, f?:number,
+                     g?:number, h?:number):void {
+        let position = this.begin(24, 9);
+        let index = this.images.indexOf(image);
+        if (index == -1) {
+            index = this.images.length;
+            this.images.push(image);
+        }
+        this.words[position] = index;
+        let floats = this.floats;
+        if (arguments.length == 9) {
+            floats[position + 1] = a;
+            floats[position + 2] = b;
+            floats[position + 3] = c;
+            floats[position + 4] = d;
+            floats[position + 5] = e;
+            floats[position + 6] = f;
+            floats[position + 7] = g;
+            floats[position + 8] = h;
+        } else {
+            floats[position + 1] = 0;
+            floats[position + 2] = 0;
+            floats[position + 3] = image.width;
+            floats[position + 4] = image.height;
+            floats[position + 5] = a;
+            floats[position + 6] = b;
+            floats[position + 7] = arguments.length == 5 ? c : image.width;
+            floats[position + 8] = arguments.length == 5 ? d : image.height;
+        }
+    }
+}
@@ -27,4 +27,4 @@
 /**
  * CanvasImageSource is a helper type representing any objects that can be drawn to Canvas.
  */
-type CanvasImageSource = Image | Canvas;
\ No newline at end of file
+type CanvasImageSource = Image | Canvas | AnimatedImage;
\ No newline at end of file
@@ -29,7 +29,7 @@
  * object. It provides the 2D rendering context for the drawing surface of a render object.<br/>
  * To get an object of this interface, call getContext() on a render object, supplying "2d" as the contextType argument.
  */
-interface CanvasRenderingContext2D {
+interface CanvasRenderingContext2D extends CanvasPath {
     /**
      * A read-only back-reference to the associated render object.
      */
@@ -47,9 +47,162 @@ interface CanvasRenderingContext2D {
     globalCompositeOperation:string;
     /**
      * Image smoothing mode; if disabled, images will not be smoothed if scaled.
-     * @default false
+     * @default true
      */
     imageSmoothingEnabled:boolean;
+    /**
+     * Saves the entire state of the canvas by pushing the current state onto a stack. The state includes the
+     * transformation matrix, globalAlpha, globalCompositeOperation, imageSmoothingEnabled and the fill and stroke
+     * styles.
+     */
+    save():void;
+    /**
+     * Restores the most recently saved canvas state by popping the top entry in the drawing state stack. If there is
+     * no saved state, this method does nothing.
+     */
+    restore():void;
+    /**
+     * Resets (overrides) the current transformation to the identity matrix and then invokes a transformation described
+     * by the arguments of this method.
+     * @param a Horizontal scaling.
+     * @param b Horizontal skewing.
+     * @param c Vertical skewing.
+     * @param d Vertical scaling.
+     * @param e Horizontal moving.
+     * @param f Vertical moving.
+     */
+    setTransform(a:number, b:number, c:number, d:number, e:number, f:number):void;
+    /**
+     * Multiplies the current transformation with the matrix described by the arguments of this method.
+     * @param a Horizontal scaling.
+     * @param b Horizontal skewing.
+     * @param c Vertical skewing.
+     * @param d Vertical scaling.
+     * @param e Horizontal moving.
+     * @param f Vertical moving.
+     */
+    transform(a:number, b:number, c:number, d:number, e:number, f:number):void;
+    /**
+     * Resets the current transform to the identity matrix.
+     */
+    resetTransform():void;
+    /**
+     * Adds a translation transformation by moving the canvas and its origin x horizontally and y vertically.
+     */
+    translate(x:number, y:number):void;
+    /**
+     * Adds a rotation to the transformation matrix. The angle argument represents a clockwise rotation angle and is
+     * expressed in radians.
+     */
+    rotate(angle:number):void;
+    /**
+     * Adds a scaling transformation to the canvas units by x horizontally and by y vertically.
+     */
+    scale(x:number, y:number):void;
+    /**
+     * The color to use inside shapes, as a CSS color string. Invalid values are ignored.
+     * @default "#000000"
+     */
+    fillStyle:string;
+    /**
+     * The color to use for the lines around shapes, as a CSS color string. Invalid values are ignored.
+     * @default "#000000"
+     */
+    strokeStyle:string;
+    /**
+     * The thickness of lines in space units. Zero, negative, Infinity and NaN values are ignored.
+     * @default 1.0
+     */
+    lineWidth:number;
+    /**
+     * Determines how the end points of every line are drawn. There are three possible values for this property and
+     * those are: "butt", "round" and "square".
+     * @default "butt"
+     */
+    lineCap:string;
+    /**
+     * Determines how two connecting segments (of lines, arcs or curves) with non-zero lengths in a shape are joined
+     * together. There are three possible values for this property: "round", "bevel" and "miter".
+     * @default "miter"
+     */
+    lineJoin:string;
+    /**
+     * The miter limit ratio in space units. Zero, negative, Infinity and NaN values are ignored.
+     * @default 10.0
+     */
+    miterLimit:number;
+    /**
+     * The current text style to use when drawing text. This string uses the same syntax as the CSS font specifier.
+     * Invalid values are ignored.
+     * @default "10px sans-serif"
+     */
+    font:string;
+    /**
+     * The current text alignment used when drawing text. Possible values: "start", "end", "left", "right" and
+     * "center".
+     * @default "start"
+     */
+    textAlign:string;
+    /**
+     * The current text baseline used when drawing text. Possible values: "alphabetic", "top", "hanging", "middle",
+     * "ideographic" and "bottom".
+     * @default "alphabetic"
+     */
+    textBaseline:string;
+    /**
+     * Starts a new path by emptying the list of sub-paths. Call this method when you want to create a new path.
+     */
+    beginPath():void;
+    /**
+     * Fills the current path or the given path with the current fill style.
+     * @param fillRule The algorithm by which to determine if a point is inside a path or outside a path, either
+     * "nonzero" or "evenodd".
+     */
+    fill(fillRule?:string):void;
+    fill(path:Path2D, fillRule?:string):void;
+    /**
+     * Strokes the current path or the given path with the current stroke style.
+     */
+    stroke(path?:Path2D):void;
+    /**
+     * Draws a filled rectangle whose starting point is at the coordinates (x, y) with the specified width and height
+     * and whose style is determined by the fillStyle attribute.
+     */
+    fillRect(x:number, y:number, width:number, height:number):void;
+    /**
+     * Paints a rectangle which has a starting point at (x, y) and has a w width and an h height onto the canvas,
+     * using the current stroke style.
+     */
+    strokeRect(x:number, y:number, width:number, height:number):void;
+    /**
+     * Sets all pixels in the rectangle defined by starting point (x, y) and size (width, height) to transparent
+     * black, erasing any previously drawn content.
+     */
+    clearRect(x:number, y:number, width:number, height:number):void;
+    /**
+     * Draws a text string at the specified coordinates, filling the string's characters with the current fillStyle.
+     * The glyphs of recently drawn strings are cached, so drawing the same label in every frame is cheap.
+     * @param text The text to render.
+     * @param x The x-axis coordinate of the point at which to begin drawing the text, in pixels.
+     * @param y The y-axis coordinate of the point at which to begin drawing the text, in pixels.
+     * @param maxWidth The maximum number of pixels wide the text may be once rendered. If not specified, there is no
+     * limit to the width of the text. The text is condensed horizontally to fit.
+     */
+    fillText(text:string, x:number, y:number, maxWidth?:number):void;
+    /**
+     * Strokes (outlines) the characters of a text string at the specified coordinates with the current strokeStyle.
+     * @param text The text to render.
+     * @param x The x-axis coordinate of the point at which to begin drawing the text, in pixels.
+     * @param y The y-axis coordinate of the point at which to begin drawing the text, in pixels.
+     * @param maxWidth The maximum number of pixels wide the text may be once rendered. If not specified, there is no
+     * limit to the width of the text. The text is condensed horizontally to fit.
+     */
+    strokeText(text:string, x:number, y:number, maxWidth?:number):void;
+    /**
+     * Returns a TextMetrics object that contains information about the measured text.
+     * @param text The text to measure.
+     */
+    measureText(text:string):TextMetrics;
     /**
      * Draws an image onto the canvas.
      * @param image An image to draw into the context.
@@ -86,4 +239,70 @@ interface CanvasRenderingContext2D {
      */
     drawImage(image:CanvasImageSource, sourceX:number, sourceY:number, sourceWidth:number, sourceHeight:number,
               targetX:number, targetY:number, targetWidth:number, targetHeight:number):void;
+    /**
+     * Draws a batch of sprites of one image onto the canvas in a single call. It is much faster than calling drawImage()
+     * for each sprite.
+     * @param image An image to draw into the context.
+     * @param sourceRects Four values for each sprite, the x, y, width and height of the sub-rectangle of the source
+     * image to draw.
+     * @param targetTransforms Four values for each sprite: scale * cos(rotation), scale * sin(rotation), the x
+     * translation and the y translation of the sprite in the destination canvas.
+     * @param colors One ARGB color (0xAARRGGBB) for each sprite, which is multiplied with the sprite. If not
+     * specified, the sprites are drawn unmodified.
+     */
+    drawImages(image:CanvasImageSource, sourceRects:Float32Array, targetTransforms:Float32Array,
+               colors?:Uint32Array):void;
+    /**
+     * Executes the drawing commands recorded by a CanvasCommandBuffer.
+     * @param buffer The buffer holding the encoded commands.
+     * @param length The number of 32-bit words to execute.
+     * @param images The images referenced by the drawImage commands.
+     * @internal
+     */
+    executeCommands(buffer:ArrayBuffer, length:number, images:CanvasImageSource[]):void;
+    /**
+     * Returns an ImageData object representing the underlying pixel data for the area of the canvas denoted by the
+     * rectangle which starts at (sx, sy) and has an sw width and sh height. Pixels outside of the canvas are returned
+     * as transparent black.
+     * @param sx The x coordinate of the upper left corner of the rectangle from which the ImageData will be extracted.
+     * @param sy The y coordinate of the upper left corner of the rectangle from which the ImageData will be extracted.
+     * @param sw The width of the rectangle from which the ImageData will be extracted.
+     * @param sh The height of the rectangle from which the ImageData will be extracted.
+     */
+    getImageData(sx:number, sy:number, sw:number, sh:number):ImageData;
+    /**
+     * Copies the pixels of the area of the canvas which starts at (sx, sy) and has the size of the given ImageData into
+     * its data, reusing the buffer instead of allocating a new one.
+     * @param imageData The ImageData to write the pixels into.
+     * @param sx The x coordinate of the upper left corner of the rectangle to read.
+     * @param sy The y coordinate of the upper left corner of the rectangle to read.
+     */
+    getImageDataInto(imageData:ImageData, sx:number, sy:number):void;
+    /**
+     * Paints data from the given ImageData object onto the canvas. If a dirty rectangle is provided, only the pixels
+     * from that rectangle are painted. This method is not affected by the canvas transformation matrix, globalAlpha
+     * and globalCompositeOperation.
+     * @param imageData An ImageData object containing the array of pixel values.
+     * @param dx Horizontal position (x-coordinate) at which to place the image data in the destination canvas.
+     * @param dy Vertical position (y-coordinate) at which to place the image data in the destination canvas.
+     * @param dirtyX Horizontal position (x-coordinate) of the top-left corner from which the image data will be
+     * extracted. Defaults to 0.
+     * @param dirtyY Vertical position (y-coordinate) of the top-left corner from which the image data will be
+     * extracted. Defaults to 0.
+     * @param dirtyWidth Width of the rectangle to be painted. Defaults to the width of the image data.
+     * @param dirtyHeight Height of the rectangle to be painted. Defaults to the height of the image data.
+     */
+    putImageData(imageData:ImageData, dx:number, dy:number, dirtyX?:number, dirtyY?:number, dirtyWidth?:number,
+                 dirtyHeight?:number):void;
+    /**
+     * Plays back the drawing commands recorded since the last flush into the render. It is called automatically at
+     * the end of each frame. Does nothing if the context is not deferred.
+     */
+    flush():void;
+    /**
+     * Plays back the last flushed frame of a deferred context into the render again without recording it, which is
+     * useful for frames that have not changed. The commands recorded since the last flush are played back first.
+     * @returns false if there is no flushed frame yet.
+     */
+    replayLastFrame():boolean;
 }
\ No newline at end of file
@@ -66,10 +66,22 @@ interface Image {
      * @param type A string indicating the image format. The default type is "image/png".
      * @param quality A number between 0 and 1 indicating image quality if the requested type is "image/jpeg"
      * or "image/webp". If this argument is anything else, the default value for image quality is used. The default
-     * value is 0.92 for "image/jpeg", and 0.8 for "image/webp". Other arguments are ignored.
+     * value is 0.92 for "image/jpeg", and 0.8 for "image/webp". For "image/png" it picks a preset between the fastest
+     * (0) and the smallest (1) encoding. An ImageEncodeOptions object can be passed instead for finer control.
      * @returns A ArrayBuffer containing the encoded image.
      */
-    encode(type?:string, quality?:number):ArrayBuffer;
+    encode(type?:string, quality?:number|ImageEncodeOptions):ArrayBuffer;
+
+    /**
+     * Compresses this Image object like encode() does, but on a background thread so that large images do not stall
+     * the frame. The callback is called on the main thread with the encoded data, or null if the image cannot be
+     * encoded.
+     * @param callback A function receiving the ArrayBuffer containing the encoded image.
+     * @param type A string indicating the image format. The default type is "image/png".
+     * @param quality A number between 0 and 1 indicating image quality, or an ImageEncodeOptions object, as for
+     * encode().
+     */
+    encodeAsync(callback:(data:ArrayBuffer|null) => void, type?:string, quality?:number|ImageEncodeOptions):void;
 
     /**
      * Generates an ImageData object from a rectangular region of pixel data.
@@ -101,10 +113,21 @@ interface Image {
      * @param type A string indicating the image format. The default type is "image/png".
      * @param quality A number between 0 and 1 indicating image quality if the requested type is "image/jpeg"
      * or "image/webp". If this argument is anything else, the default value for image quality is used. The default
-     * value is 0.92 for "image/jpeg", and 0.8 for "image/webp". Other arguments are ignored.
+     * value is 0.92 for "image/jpeg", and 0.8 for "image/webp". For "image/png" it picks a preset between the fastest
+     * (0) and the smallest (1) encoding. An ImageEncodeOptions object can be passed instead for finer control.
      * @returns A string containing the data URI of encoded image.
      */
-    toDataURL(type?:string, quality?:number):string;
+    toDataURL(type?:string, quality?:number|ImageEncodeOptions):string;
+
+    /**
+     * Generates a data URI like toDataURL() does, but encodes the image on a background thread. The callback is called
+     * on the main thread with the data URI.
+     * @param callback A function receiving the string containing the data URI of encoded image.
+     * @param type A string indicating the image format. The default type is "image/png".
+     * @param quality A number between 0 and 1 indicating image quality, or an ImageEncodeOptions object, as for
+     * encode().
+     */
+    toDataURLAsync(callback:(url:string) => void, type?:string, quality?:number|ImageEncodeOptions):void;
 }
 
 declare let Image:{
@@ -116,4 +139,13 @@ declare let Image:{
      * Setting the transparent property to false can result in minor improvements in rendering performance.
      */
     new(data:ImageData, transparent?:boolean):Image;
+    /**
+     * Sets the budget, in bytes, of the cache holding the pixels of images loaded with the lazy option. When the cache
+     * goes over budget, the least recently drawn images are discarded and decoded again the next time they are drawn.
+     */
+    setDecodedCacheLimit(bytes:number):void;
+    /**
+     * Returns the number of bytes currently used by the cache holding the pixels of lazily decoded images.
+     */
+    getDecodedCacheUsage():number;
 }
\ No newline at end of file
@@ -0,0 +1,43 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The ImageAtlas class packs many images into a few large images at runtime. Sprites that come from the same packed
+ * image share one texture, so consecutive draws of them can be batched by the GPU instead of switching between many
+ * small images.
+ */
+declare let ImageAtlas:{
+    /**
+     * Packs the images into pages and returns one Image per source, in the same order. Each returned Image is a view
+     * of its page made like makeSubset() does, sharing the pixels of the page. The sources are copied, so they can be
+     * disposed afterwards. A source larger than the page size gets a page of its own.
+     * @param sources The images or canvases to pack. Disposed or empty sources get null in the result.
+     * @param pageSize The largest width and height of a page, in pixels. The default value is 2048.
+     * @param padding The number of transparent pixels kept between two packed images, which keeps filtered sprites
+     * from sampling their neighbours. The default value is 1.
+     */
+    pack(sources:CanvasImageSource[], pageSize?:number, padding?:number):Image[];
+}
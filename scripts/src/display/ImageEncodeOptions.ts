@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The ImageEncodeOptions interface describes how Image.encode() and Image.toDataURL() compress an image. It can be
+ * passed in place of the quality number.
+ */
+interface ImageEncodeOptions {
+    /**
+     * A number between 0 and 1 indicating image quality if the requested type is "image/jpeg" or "image/webp".
+     */
+    quality?:number;
+    /**
+     * The zlib compression level used for "image/png", from 0 (no compression, fastest) to 9 (smallest size). The
+     * default value is 6.
+     */
+    compressionLevel?:number;
+    /**
+     * The filter applied to each row before compression for "image/png". One of "none", "sub", "up", "average",
+     * "paeth" or "adaptive", which picks the best filter for each row. The default value is "adaptive".
+     */
+    filter?:string;
+    /**
+     * If true, large "image/png" images are compressed in horizontal bands on separate threads, which is much faster
+     * and produces slightly larger files. The default value is true.
+     */
+    parallel?:boolean;
+}
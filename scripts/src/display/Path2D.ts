@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The path building methods shared by Path2D and CanvasRenderingContext2D.
+ */
+interface CanvasPath {
+    /**
+     * Causes the point of the pen to move back to the start of the current sub-path. It tries to add a straight line
+     * (but does not actually draw it) from the current point to the start. If the shape has already been closed or
+     * has only one point, this function does nothing.
+     */
+    closePath():void;
+    /**
+     * Moves the starting point of a new sub-path to the (x, y) coordinates.
+     */
+    moveTo(x:number, y:number):void;
+    /**
+     * Connects the last point in the sub-path to the (x, y) coordinates with a straight line (but does not actually
+     * draw it).
+     */
+    lineTo(x:number, y:number):void;
+    /**
+     * Adds a quadratic Bézier curve to the path. It requires two points. The first point is a control point and the
+     * second one is the end point. The starting point is the last point in the current path.
+     */
+    quadraticCurveTo(cpx:number, cpy:number, x:number, y:number):void;
+    /**
+     * Adds a cubic Bézier curve to the path. It requires three points. The first two points are control points and
+     * the third one is the end point. The starting point is the last point in the current path.
+     */
+    bezierCurveTo(cp1x:number, cp1y:number, cp2x:number, cp2y:number, x:number, y:number):void;
+    /**
+     * Adds an arc to the path with the given control points and radius, connected to the previous point by a straight
+     * line. Throws a RangeError if the radius is negative.
+     */
+    arcTo(x1:number, y1:number, x2:number, y2:number, radius:number):void;
+    /**
+     * Adds an arc to the path which is centered at (x, y) position with radius r starting at startAngle and ending at
+     * endAngle going in the given direction by anticlockwise (defaulting to clockwise). Throws a RangeError if the
+     * radius is negative.
+     */
+    arc(x:number, y:number, radius:number, startAngle:number, endAngle:number, anticlockwise?:boolean):void;
+    /**
+     * Creates a path for a rectangle at position (x, y) with a size that is determined by width and height. Those
+     * four points are connected by straight lines and the sub-path is marked as closed, so that you can fill or
+     * stroke this rectangle.
+     */
+    rect(x:number, y:number, width:number, height:number):void;
+}
+
+/**
+ * The Path2D interface is used to declare paths that are then later used on CanvasRenderingContext2D objects. A
+ * Path2D keeps its geometry natively, so drawing the same path in every frame does not rebuild it.
+ */
+interface Path2D extends CanvasPath {
+    /**
+     * Adds the sub-paths of another path to this path.
+     */
+    addPath(path:Path2D):void;
+}
+
+declare let Path2D:{
+    prototype:Path2D;
+    /**
+     * Creates a new Path2D object, optionally with a copy of another path or with SVG path data, e.g.
+     * "M10 10 h 80 v 80 h -80 Z". Throws a TypeError if the SVG path data is invalid.
+     */
+    new(path?:Path2D|string):Path2D;
+}
@@ -0,0 +1,67 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The TextMetrics interface represents the dimensions of a piece of text in the canvas, as created by the
+ * CanvasRenderingContext2D.measureText() method. The distances are relative to the anchor point given by the
+ * textAlign and textBaseline properties.
+ */
+interface TextMetrics {
+    /**
+     * The advance width of the text.
+     */
+    readonly width:number;
+    /**
+     * The distance from the anchor point to the left side of the bounding rectangle of the given text, positive
+     * numbers indicating a distance going left.
+     */
+    readonly actualBoundingBoxLeft:number;
+    /**
+     * The distance from the anchor point to the right side of the bounding rectangle of the given text, positive
+     * numbers indicating a distance going right.
+     */
+    readonly actualBoundingBoxRight:number;
+    /**
+     * The distance from the anchor point to the top of the bounding rectangle used to render the text, positive
+     * numbers indicating a distance going up.
+     */
+    readonly actualBoundingBoxAscent:number;
+    /**
+     * The distance from the anchor point to the bottom of the bounding rectangle used to render the text, positive
+     * numbers indicating a distance going down.
+     */
+    readonly actualBoundingBoxDescent:number;
+    /**
+     * The distance from the anchor point to the top of the highest bounding rectangle of all the fonts used to render
+     * the text.
+     */
+    readonly fontBoundingBoxAscent:number;
+    /**
+     * The distance from the anchor point to the bottom of the bounding rectangle of all the fonts used to render the
+     * text.
+     */
+    readonly fontBoundingBoxDescent:number;
+}
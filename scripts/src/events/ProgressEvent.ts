@@ -0,0 +1,60 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * A ProgressEvent object is emitted while a load operation is in progress.
+ */
+class ProgressEvent extends Event {
+
+    /**
+     * Emitted when a part of the data of a load operation is available.
+     */
+    public static readonly PROGRESS:string = "progress";
+
+    /**
+     * Creates an Event object that contains information about progress events. Event objects are passed as parameters
+     * to Event listeners.
+     * @param type The type of the event.
+     * @param cancelable Determine whether the Event object can be canceled. The default value is false.
+     * @param loaded The amount of work already done.
+     * @param total The total amount of work.
+     */
+    public constructor(type:string, cancelable?:boolean, loaded:number = 0, total:number = 0) {
+        super(type, cancelable);
+        this.loaded = loaded;
+        this.total = total;
+    }
+
+    /**
+     * The amount of work already done, such as the number of image rows decoded.
+     */
+    public loaded:number;
+
+    /**
+     * The total amount of work, in the same unit as loaded.
+     */
+    public total:number;
+}
@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * The ImageDecodeOptions interface describes the size an image is loaded for. When the image is only ever drawn smaller
+ * than its full size, decoding it at a reduced size is much faster and uses much less memory.
+ */
+interface ImageDecodeOptions {
+    /**
+     * The largest width the image will be drawn at. The image is decoded at the smallest size the codec supports that
+     * is not smaller than maxWidth and maxHeight, so the loaded image may be somewhat larger. It is never upscaled.
+     */
+    maxWidth?:number;
+    /**
+     * The largest height the image will be drawn at.
+     */
+    maxHeight?:number;
+    /**
+     * If true, only the encoded data is kept when the image is loaded. It is decoded the first time it is drawn, and the
+     * decoded pixels are discarded again when the shared cache set by Image.setDecodedCacheLimit() runs over budget.
+     * This allows keeping many images loaded with a fraction of the memory. Ignored when the image has to be decoded at a
+     * reduced size or to another colorType than "rgba8888". The default value is false.
+     */
+    lazy?:boolean;
+    /**
+     * If true, the image is decoded top-down in bands of rows, and the ImageLoader emits a ProgressEvent.PROGRESS event
+     * after each band with a drawable image of the rows decoded so far in its data property, which is only as tall as
+     * those rows. This allows showing very large images before they are completely decoded. Ignored for lazy images,
+     * images decoded at a reduced size or to another color type, and formats that cannot be decoded row by row. The
+     * default value is false.
+     */
+    progressive?:boolean;
+    /**
+     * The format of the decoded pixels. "rgb565" takes half the memory of the default "rgba8888" and suits opaque
+     * photos and backgrounds. "alpha8" only keeps the alpha channel, one byte per pixel, and the image is drawn
+     * filled with the current fillStyle like a mask. "gray8" keeps the luminance in one byte per pixel. Images with
+     * transparent pixels are decoded as "rgba8888" when asked for "rgb565" or "gray8", which cannot store alpha.
+     * Takes precedence over the lazy option. The default value is "rgba8888".
+     */
+    colorType?:"rgba8888" | "rgb565" | "alpha8" | "gray8";
+}
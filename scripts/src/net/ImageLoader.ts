@@ -34,8 +34,12 @@ namespace cyder {
      * @param url The URL of the image to be loaded.
      * @param callback The callback function that receive the loaded image data.
      * @param thisArg The value of this provided for the call to the callback function.
+     * @param options The size the image is decoded for.
+     * @param progressCallback The callback function that receives the partially decoded images of a progressive load.
      */
-    export declare function loadImageFromURL(url:string, callback:(data:Image) => void, thisArg:any);
+    export declare function loadImageFromURL(url:string, callback:(data:Image) => void, thisArg:any,
+                                             options?:ImageDecodeOptions,
+                                             progressCallback?:(data:Image, loaded:number, total:number) => void);
 
     /**
      * @internal
@@ -43,22 +47,112 @@ namespace cyder {
      * @param bytes The byte array of image to be loaded.
      * @param callback The callback function that receive the loaded image data.
      * @param thisArg The value of this provided for the call to the callback function.
+     * @param options The size the image is decoded for.
+     * @param progressCallback The callback function that receives the partially decoded images of a progressive load.
      */
-    export declare function loadImageFromBytes(bytes:ArrayBuffer, callback:(data:Image) => void, thisArg:any);
+    export declare function loadImageFromBytes(bytes:ArrayBuffer, callback:(data:Image) => void, thisArg:any,
+                                               options?:ImageDecodeOptions,
+                                               progressCallback?:(data:Image, loaded:number, total:number) => void);
+
+    /**
+     * @internal
+     */
+    export declare function setImageDecodeConcurrency(count:number):void;
+
+    /**
+     * @internal
+     */
+    export declare function setImageCacheLimit(bytes:number):void;
+
+    /**
+     * @internal
+     */
+    export declare function getImageCacheStats():ImageCacheStats;
+
+    /**
+     * @internal
+     */
+    export declare function setImageDiskCacheDirectory(directory:string):void;
+
+    /**
+     * @internal
+     */
+    export declare function setImageDiskCacheLimit(bytes:number):void;
+
+    /**
+     * @internal
+     */
+    export declare function clearImageDiskCache():void;
 
     /**
      * @internal
      */
     let ioErrorEvent = new IOErrorEvent(IOErrorEvent.IO_ERROR);
 
+    /**
+     * @internal
+     */
+    let progressEvent = new ProgressEvent(ProgressEvent.PROGRESS);
+
     /**
      * @internal
      * The Loader class is used to load image (JPG, PNG, or GIF) files. Use the load() method to initiate loading.
      * The loaded image data is in the data property of ImageLoader.
      * @event Event.COMPLETE Emitted when the net request is complete.
+     * @event ProgressEvent.PROGRESS Emitted after each band of rows of a progressive load is decoded.
      * @event IOErrorEvent.IO_ERROR Emitted when the net request is failed.
      */
     export class ImageLoader extends cyder.EventEmitter {
+        /**
+         * Sets the maximum number of images that are read and decoded on background threads at the same time. Loads
+         * started beyond this number wait for a running one to finish. The default is half the number of hardware
+         * threads, at least 1.
+         */
+        public static setDecodeConcurrency(count:number):void {
+            cyder.setImageDecodeConcurrency(count);
+        }
+
+        /**
+         * Sets the maximum number of bytes of decoded pixels the image cache keeps. Loading a file or bytes that are
+         * already in the cache shares the decoded pixels instead of reading and decoding them again. The default limit
+         * is 64MB.
+         */
+        public static setCacheLimit(bytes:number):void {
+            cyder.setImageCacheLimit(bytes);
+        }
+
+        /**
+         * Returns the usage and the hit and miss counts of the image cache.
+         */
+        public static getCacheStats():ImageCacheStats {
+            return cyder.getImageCacheStats();
+        }
+
+        /**
+         * Sets the directory that keeps the decoded pixels of loaded image files across application starts. An image
+         * file that is already in it is mapped into memory instead of being decoded again, which makes warm starts much
+         * faster. Entries are checked against the modification time and size of the file. Relative paths are resolved
+         * from the application directory. The disk cache is disabled by default, pass null to disable it again.
+         */
+        public static setDiskCacheDirectory(directory:string):void {
+            cyder.setImageDiskCacheDirectory(directory);
+        }
+
+        /**
+         * Sets the maximum number of bytes the disk cache may take. The least recently used entries are removed once it
+         * grows over the limit. The default limit is 256MB.
+         */
+        public static setDiskCacheLimit(bytes:number):void {
+            cyder.setImageDiskCacheLimit(bytes);
+        }
+
+        /**
+         * Removes all the entries of the disk cache.
+         */
+        public static clearDiskCache():void {
+            cyder.clearImageDiskCache();
+        }
+
         /**
          * Creates a ImageLoader instance.
          */
@@ -76,33 +170,67 @@ namespace cyder {
          */
         private currentURL:string;
 
+        /**
+         * @private
+         * Identifies the latest load operation, the results of the previous ones are dropped.
+         */
+        private loadID:number = 0;
+
         /**
          * start a load operation。<br/>
          * Note: Calling this method for an already active request (one for which load() has already been called) will abort
          * the last load operation immediately.
          * @param url The URL of the image to be loaded.
+         * @param options The size the image is decoded for. By default the image is decoded at full size.
          */
-        public load(url:string):void {
+        public load(url:string, options?:ImageDecodeOptions):void {
             this.currentURL = url;
-            cyder.loadImageFromURL(url, this.onLoadFinish, this);
+            let loadID = ++this.loadID;
+            cyder.loadImageFromURL(url, (data:Image) => {
+                this.onLoadFinish(loadID, data);
+            }, this, options, (data:Image, loaded:number, total:number) => {
+                this.onLoadProgress(loadID, data, loaded, total);
+            });
         }
 
         /**
          * Loads image from binary data stored in a ArrayBuffer object.
          * @param bytes The binary data of the image to be loaded.
+         * @param options The size the image is decoded for. By default the image is decoded at full size.
          */
-        public loadBytes(bytes:ArrayBuffer):void {
+        public loadBytes(bytes:ArrayBuffer, options?:ImageDecodeOptions):void {
             this.currentURL = "";
             if (bytes.byteLength == 0) {
                 throw new Error("The ArrayBuffer parameter in ImageLoader.loadBytes() must have length greater than 0.");
             }
-            cyder.loadImageFromBytes(bytes, this.onLoadFinish, this);
+            let loadID = ++this.loadID;
+            cyder.loadImageFromBytes(bytes, (data:Image) => {
+                this.onLoadFinish(loadID, data);
+            }, this, options, (data:Image, loaded:number, total:number) => {
+                this.onLoadProgress(loadID, data, loaded, total);
+            });
+        }
+
+        /**
+         * @private
+         */
+        private onLoadProgress(loadID:number, data:Image, loaded:number, total:number) {
+            if (loadID != this.loadID) {
+                return;
+            }
+            this.data = data;
+            progressEvent.loaded = loaded;
+            progressEvent.total = total;
+            this.emit(progressEvent);
         }
 
         /**
          * @private
          */
-        private onLoadFinish(data:Image) {
+        private onLoadFinish(loadID:number, data:Image) {
+            if (loadID != this.loadID) {
+                return;
+            }
             this.data = data;
             if (data) {
                 this.emitWith(Event.COMPLETE);
@@ -129,6 +257,7 @@ namespace cyder {
  * The Loader class is used to load image (JPG, PNG, or GIF) files. Use the load() method to initiate loading.
  * The loaded image data is in the data property of ImageLoader.
  * @event Event.COMPLETE Emitted when the net request is complete.
+ * @event ProgressEvent.PROGRESS Emitted after each band of rows of a progressive load is decoded.
  * @event IOErrorEvent.IO_ERROR Emitted when the net request is failed.
  */
 interface ImageLoader extends EventEmitter {
@@ -142,14 +271,16 @@ interface ImageLoader extends EventEmitter {
      * Note: Calling this method for an already active request (one for which load() has already been called) will abort
      * the last load operation immediately.
      * @param url The URL of the image to be loaded.
+     * @param options The size the image is decoded for. By default the image is decoded at full size.
      */
-    load(url:string):void;
+    load(url:string, options?:ImageDecodeOptions):void;
 
     /**
      * Loads image from binary data stored in a ArrayBuffer object.
      * @param bytes The binary data of the image to be loaded.
+     * @param options The size the image is decoded for. By default the image is decoded at full size.
      */
-    loadBytes(bytes:ArrayBuffer):void;
+    loadBytes(bytes:ArrayBuffer, options?:ImageDecodeOptions):void;
 }
 
 let ImageLoader:{
@@ -157,6 +288,38 @@ let ImageLoader:{
      * Creates a ImageLoader instance.
      */
     new():ImageLoader;
+    /**
+     * Sets the maximum number of images that are read and decoded on background threads at the same time. Loads
+     * started beyond this number wait for a running one to finish. The default is half the number of hardware threads,
+     * at least 1.
+     */
+    setDecodeConcurrency(count:number):void;
+    /**
+     * Sets the maximum number of bytes of decoded pixels the image cache keeps. Loading a file or bytes that are
+     * already in the cache shares the decoded pixels instead of reading and decoding them again. The default limit is
+     * 64MB.
+     */
+    setCacheLimit(bytes:number):void;
+    /**
+     * Returns the usage and the hit and miss counts of the image cache.
+     */
+    getCacheStats():ImageCacheStats;
+    /**
+     * Sets the directory that keeps the decoded pixels of loaded image files across application starts. An image file
+     * that is already in it is mapped into memory instead of being decoded again, which makes warm starts much
+     * faster. Entries are checked against the modification time and size of the file. Relative paths are resolved
+     * from the application directory. The disk cache is disabled by default, pass null to disable it again.
+     */
+    setDiskCacheDirectory(directory:string):void;
+    /**
+     * Sets the maximum number of bytes the disk cache may take. The least recently used entries are removed once it
+     * grows over the limit. The default limit is 256MB.
+     */
+    setDiskCacheLimit(bytes:number):void;
+    /**
+     * Removes all the entries of the disk cache.
+     */
+    clearDiskCache():void;
 };
 
 ImageLoader = cyder.ImageLoader;
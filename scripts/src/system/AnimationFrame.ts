@@ -30,19 +30,37 @@
 namespace cyder {
 
     let callbackList:FrameRequestCallback[] = [];
+    let frameEndList:(() => void)[] = [];
     let requested = false;
 
     export declare function requestFrame():void;
 
     export function updateFrame(timestamp:number):void {
         requested = false;
-        if (callbackList.length == 0) {
-            return;
+        if (callbackList.length > 0) {
+            let list = callbackList;
+            callbackList = [];
+            for (let callback of list) {
+                callback(timestamp);
+            }
         }
-        let list = callbackList;
-        callbackList = [];
-        for (let callback of list) {
-            callback(timestamp);
+        if (frameEndList.length > 0) {
+            let list = frameEndList;
+            frameEndList = [];
+            for (let callback of list) {
+                callback();
+            }
+        }
+    }
+
+    /**
+     * Calls the function once at the end of the next frame, after all the animation frame callbacks have run.
+     */
+    export function callAtFrameEnd(callback:() => void):void {
+        frameEndList.push(callback);
+        if (!requested) {
+            requested = true;
+            cyder.requestFrame();
         }
     }
 
@@ -26,15 +26,25 @@
 
 
 #include "Environment.h"
-#include <fstream>
+#include "platform/MappedFile.h"
+#include "utils/ExternalMemory.h"
 
 namespace cyder {
 
+    static void ReportExternalMemory(v8::Isolate* isolate) {
+        auto change = ExternalMemory::TakePendingChange();
+        if (change != 0) {
+            isolate->AdjustAmountOfExternalAllocatedMemory(change);
+        }
+    }
+
     WeakHandle::WeakHandle(v8::Isolate* isolate, const v8::Local<v8::Object>& handle, std::function<void()> callback) :
+            isolate(isolate),
             persistent(isolate, handle),
             callback(callback) {
         persistent.SetWeak(this, Callback, v8::WeakCallbackType::kParameter);
         persistent.MarkIndependent();
+        ReportExternalMemory(isolate);
     }
 
     WeakHandle::~WeakHandle() {
@@ -43,6 +53,7 @@ namespace cyder {
         }
         persistent.ClearWeak();
         persistent.Reset();
+        ReportExternalMemory(isolate);
     }
 
     void WeakHandle::Callback(const v8::WeakCallbackInfo<WeakHandle>& data) {
@@ -54,6 +65,16 @@ namespace cyder {
             handle->callback();
         }
         delete handle;
+        // V8 can not be called during the first pass, report the freed memory once the collection is finished.
+        data.SetSecondPassCallback(SecondPassCallback);
+    }
+
+    void WeakHandle::SecondPassCallback(const v8::WeakCallbackInfo<WeakHandle>& data) {
+        ReportExternalMemory(data.GetIsolate());
+    }
+
+    void Environment::reportExternalMemory() const {
+        ReportExternalMemory(_isolate);
     }
 
     Environment::Environment(const v8::Local<v8::Context>& context) {
@@ -75,12 +96,60 @@ namespace cyder {
         return new WeakHandle(_isolate, handle, callback);
     }
 
+    /**
+     * Lets V8 read an ASCII script directly from its file mapping. V8 deletes the resource when the string is garbage
+     * collected.
+     */
+    class MappedScriptResource : public v8::String::ExternalOneByteStringResource {
+    public:
+        explicit MappedScriptResource(MappedFile* file) : file(file) {
+        }
+
+        ~MappedScriptResource() override {
+            delete file;
+        }
+
+        const char* data() const override {
+            return static_cast<const char*>(file->data());
+        }
+
+        size_t length() const override {
+            return file->size();
+        }
+
+    private:
+        MappedFile* file;
+    };
+
+    static bool IsASCII(const char* text, size_t length) {
+        for (size_t i = 0; i < length; i++) {
+            if (static_cast<unsigned char>(text[i]) >= 0x80) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    v8::MaybeLocal<v8::String> Environment::readScript(const std::string& path) const {
+        auto file = MappedFile::Open(path);
+        if (!file) {
+            return makeString("");
+        }
+        auto text = static_cast<const char*>(file->data());
+        auto length = file->size();
+        if (length > 0 && IsASCII(text, length)) {
+            return v8::String::NewExternalOneByte(_isolate, new MappedScriptResource(file));
+        }
+        // One-byte strings are Latin-1, so a UTF-8 script with non-ASCII characters has to be converted.
+        auto result = v8::String::NewFromUtf8(_isolate, length > 0 ? text : "", v8::NewStringType::kNormal,
+                                              static_cast<int>(length));
+        delete file;
+        return result;
+    }
+
     v8::MaybeLocal<v8::Value> Environment::executeScript(const std::string& path) {
-        std::ifstream in(path);
-        std::istreambuf_iterator<char> beg(in), end;
-        std::string jsText(beg, end);
         // Create a string containing the JavaScript source code.
-        auto maybeSource = makeString(jsText);
+        auto maybeSource = readScript(path);
         ASSERT(!maybeSource.IsEmpty());
         if (maybeSource.IsEmpty()) {
             return v8::MaybeLocal<v8::Value>();
@@ -58,7 +58,9 @@ namespace cyder {
         ~WeakHandle();
     private:
         static void Callback(const v8::WeakCallbackInfo<WeakHandle>& data);
+        static void SecondPassCallback(const v8::WeakCallbackInfo<WeakHandle>& data);
         WeakHandle(v8::Isolate* isolate, const v8::Local<v8::Object>& handle, std::function<void()> callback);
+        v8::Isolate* isolate;
         v8::Persistent<v8::Object> persistent;
         std::function<void()> callback;
 
@@ -126,6 +128,13 @@ namespace cyder {
          */
         v8::MaybeLocal<v8::Value> executeScript(const std::string& path);
 
+        /**
+         * Tells V8 about the native memory allocated or freed for script objects since the last report, so that the
+         * garbage collector runs as often as the real memory usage needs. It is called whenever an object is bound or
+         * collected, and once per frame.
+         */
+        void reportExternalMemory() const;
+
         void throwError(ErrorType errorType, const std::string& errorText);
 
         void printStackTrace(const v8::TryCatch& tryCatch);
@@ -245,6 +254,14 @@ namespace cyder {
             v8::Local<v8::Value> argv[] = {arg0, arg1, arg2};
             return function->NewInstance(context(), 3, argv);
         }
+        v8::MaybeLocal<v8::Object> newInstance(const v8::Local<v8::Function>& function,
+                                               const v8::Local<v8::Value>& arg0,
+                                               const v8::Local<v8::Value>& arg1,
+                                               const v8::Local<v8::Value>& arg2,
+                                               const v8::Local<v8::Value>& arg3) const {
+            v8::Local<v8::Value> argv[] = {arg0, arg1, arg2, arg3};
+            return function->NewInstance(context(), 4, argv);
+        }
 
         //==================================== Call Methods ====================================
 
@@ -568,6 +585,11 @@ namespace cyder {
     private:
         static const int CONTEXT_EMBEDDER_DATA_INDEX = 2;
 
+        /**
+         * Reads a script file through a memory mapping, ASCII scripts are handed to V8 without being copied.
+         */
+        v8::MaybeLocal<v8::String> readScript(const std::string& path) const;
+
         template<class T>
         static v8::Local<T>& StrongPersistentToLocal(const v8::Persistent<T>& persistent) {
             return *reinterpret_cast<v8::Local<T>*>(const_cast<v8::Persistent<T>*>(&persistent));
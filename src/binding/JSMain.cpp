@@ -33,8 +33,12 @@
 #include "binding/v8/V8NativeWindow.h"
 #include "binding/v8/V8Image.h"
 #include "binding/v8/V8ImageLoader.h"
+#include "binding/v8/V8ImageAtlas.h"
+#include "binding/v8/V8AnimatedImage.h"
+#include "binding/v8/V8Path2D.h"
 #include "binding/v8/V8CanvasRenderingContext2D.h"
 #include "binding/v8/V8Canvas.h"
+#include "binding/v8/V8File.h"
 
 
 namespace cyder {
@@ -55,6 +59,10 @@ namespace cyder {
         V8AnimationFrame::install(global, env);
         V8Image::install(global, env);
         V8ImageLoader::install(global, env);
+        V8ImageAtlas::install(global, env);
+        V8AnimatedImage::install(global, env);
+        V8File::install(global, env);
+        V8Path2D::install(global, env);
         V8CanvasRenderingContext2D::install(global, env);
         V8Canvas::install(global, env);
         V8NativeApplication::install(global, env);
@@ -0,0 +1,156 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "V8AnimatedImage.h"
+#include "modules/image/AnimatedImage.h"
+
+namespace cyder {
+
+    static AnimatedImage* getAnimatedImage(const v8::Local<v8::Object>& self, Environment* env) {
+        auto image = static_cast<AnimatedImage*>(self->GetAlignedPointerFromInternalField(0));
+        if (!image) {
+            env->throwError(ErrorType::ERROR, "Invalid AnimatedImage.");
+            return nullptr;
+        }
+        return image;
+    }
+
+    static void currentFrameGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto image = getAnimatedImage(args.This(), env);
+        if (!image) {
+            return;
+        }
+        args.GetReturnValue().Set(env->makeValue(image->currentFrame()));
+    }
+
+    static void playingGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto image = getAnimatedImage(args.This(), env);
+        if (!image) {
+            return;
+        }
+        args.GetReturnValue().Set(env->makeValue(image->playing()));
+    }
+
+    static void playMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto image = getAnimatedImage(args.This(), env);
+        if (!image) {
+            return;
+        }
+        image->play();
+    }
+
+    static void stopMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto image = getAnimatedImage(args.This(), env);
+        if (!image) {
+            return;
+        }
+        image->stop();
+    }
+
+    static void gotoFrameMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto image = getAnimatedImage(args.This(), env);
+        if (!image) {
+            return;
+        }
+        image->gotoFrame(env->toInt(args[0]));
+    }
+
+    static void disposeMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto self = args.This();
+        auto image = static_cast<AnimatedImage*>(self->GetAlignedPointerFromInternalField(0));
+        if (!image) {
+            return;
+        }
+        env->setObjectProperty(self, "width", 0);
+        env->setObjectProperty(self, "height", 0);
+        self->SetAlignedPointerInInternalField(0, nullptr);
+        auto weakHandle = static_cast<WeakHandle*>(self->GetAlignedPointerFromInternalField(1));
+        self->SetAlignedPointerInInternalField(1, nullptr);
+        delete weakHandle;
+        delete image;
+    }
+
+    static void constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        if (!args[0]->IsArrayBuffer()) {
+            env->throwError(ErrorType::TYPE_ERROR,
+                            "Failed to construct 'AnimatedImage': parameter 1 is not of type 'ArrayBuffer'.");
+            return;
+        }
+        auto arrayBuffer = v8::Local<v8::ArrayBuffer>::Cast(args[0]);
+        auto image = AnimatedImage::Decode(arrayBuffer->GetContents().Data(), arrayBuffer->ByteLength());
+        if (!image) {
+            env->throwError(ErrorType::TYPE_ERROR,
+                            "Failed to construct 'AnimatedImage': parameter 1 is not a supported image.");
+            return;
+        }
+        auto self = args.This();
+        self->SetAlignedPointerInInternalField(0, image);
+        env->setObjectProperty(self, "width", env->makeValue(image->width()));
+        env->setObjectProperty(self, "height", env->makeValue(image->height()));
+        env->setObjectProperty(self, "frameCount", env->makeValue(image->frameCount()), true);
+        auto handle = env->bind(self, image);
+        self->SetAlignedPointerInInternalField(1, handle);
+    }
+
+    static void setFrameCacheLimitMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto bytes = env->toDouble(args[0]);
+        if (!(bytes >= 0)) {
+            env->throwError(ErrorType::RANGE_ERROR, "Failed to execute 'setFrameCacheLimit' on 'AnimatedImage': "
+                                                    "the limit must not be negative.");
+            return;
+        }
+        AnimatedImage::SetFrameCacheLimit(static_cast<size_t>(bytes));
+    }
+
+    static void getFrameCacheUsageMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        args.GetReturnValue().Set(env->makeValue(static_cast<double>(AnimatedImage::FrameCacheUsage())));
+    }
+
+    void V8AnimatedImage::install(const v8::Local<v8::Object>& parent, Environment* env) {
+        auto classTemplate = env->makeFunctionTemplate(constructor);
+        auto prototypeTemplate = classTemplate->PrototypeTemplate();
+        env->setTemplateAccessor(prototypeTemplate, "currentFrame", currentFrameGetter);
+        env->setTemplateAccessor(prototypeTemplate, "playing", playingGetter);
+        env->setTemplateProperty(prototypeTemplate, "dispose", disposeMethod);
+        env->setTemplateProperty(prototypeTemplate, "gotoFrame", gotoFrameMethod);
+        env->setTemplateProperty(prototypeTemplate, "play", playMethod);
+        env->setTemplateProperty(prototypeTemplate, "stop", stopMethod);
+        env->setTemplateProperty(classTemplate, "setFrameCacheLimit", setFrameCacheLimitMethod);
+        env->setTemplateProperty(classTemplate, "getFrameCacheUsage", getFrameCacheUsageMethod);
+        env->attachClass(parent, "AnimatedImage", classTemplate, 2);
+    }
+
+}
@@ -26,6 +26,9 @@
 
 #include "V8AnimationFrame.h"
 #include "platform/AnimationFrame.h"
+#include "modules/canvas2d/CanvasRenderingContext2D.h"
+#include "modules/canvas/OffScreenBuffer.h"
+#include "modules/image/AnimatedImage.h"
 
 namespace cyder {
 
@@ -35,12 +38,20 @@ namespace cyder {
         v8::HandleScope scope(isolate);
         v8::Context::Scope contextScope(env->context());
         v8::TryCatch tryCatch(isolate);
+        // Animated images are drawn by the frame callbacks, so they have to show the frame of this timestamp first.
+        AnimatedImage::AdvanceAll(timestamp);
+        AnimationFrame::SetInFrameUpdate(true);
         auto updateFunction = env->readGlobalFunction("cyder.updateFrame");
         auto result = env->call(updateFunction, env->makeNull(), env->makeValue(timestamp));
         if (result.IsEmpty()) {
             env->printStackTrace(tryCatch);
             abort();
         }
+        CanvasRenderingContext2D::FlushAll();
+        OffScreenBuffer::RasterizeAll();
+        AnimationFrame::SetInFrameUpdate(false);
+        // Catches the memory changes no binding saw, such as surfaces resized by the scripts of this frame.
+        env->reportExternalMemory();
     }
 
     static void requestAnimationFrameMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
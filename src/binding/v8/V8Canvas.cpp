@@ -25,6 +25,7 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "V8Canvas.h"
+#include "V8Image.h"
 #include "modules/canvas2d/CanvasRenderingContext2D.h"
 #include "modules/canvas/OffScreenBuffer.h"
 #include "modules/canvas/Canvas.h"
@@ -55,6 +56,12 @@ namespace cyder {
         canvas->setHeight(env->toInt(value));
     }
 
+    static void resizeMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto canvas = static_cast<Canvas*>(args.This()->GetAlignedPointerFromInternalField(0));
+        canvas->resize(env->toInt(args[0]), env->toInt(args[1]));
+    }
+
     static void getContextMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
         auto env = Environment::GetCurrent(args);
         v8::HandleScope scope(env->isolate());
@@ -73,24 +80,41 @@ namespace cyder {
         canvas->contextType = contextType;
         if (contextType == "2d") {
             auto CanvasRenderingContext2DClass = env->readGlobalFunction("CanvasRenderingContext2D");
-            if (!canvas->buffer) {
-                bool hasAlpha = true;
-                bool useGPU = true;
-                if (args[1]->IsObject()) {
-                    auto contextAttributes = v8::Local<v8::Object>::Cast(args[1]);
-                    auto alphaValue = env->getValue(contextAttributes, "alpha");
-                    if (!alphaValue.IsEmpty()) {
-                        hasAlpha = alphaValue.ToLocalChecked()->BooleanValue(env->context()).FromMaybe(false);
-                    }
-                    auto willReadFrequentlyValue = env->getValue(contextAttributes, "willReadFrequently");
-                    if (!willReadFrequentlyValue.IsEmpty()) {
-                        useGPU = !willReadFrequentlyValue.ToLocalChecked()->
-                                BooleanValue(env->context()).FromMaybe(false);
-                    }
+            bool hasAlpha = true;
+            bool useGPU = true;
+            bool deferred = false;
+            bool tiledRaster = false;
+            SkColorType colorType = kN32_SkColorType;
+            if (args[1]->IsObject()) {
+                auto contextAttributes = v8::Local<v8::Object>::Cast(args[1]);
+                auto alphaValue = env->getValue(contextAttributes, "alpha");
+                if (!alphaValue.IsEmpty()) {
+                    hasAlpha = alphaValue.ToLocalChecked()->BooleanValue(env->context()).FromMaybe(false);
+                }
+                auto willReadFrequentlyValue = env->getValue(contextAttributes, "willReadFrequently");
+                if (!willReadFrequentlyValue.IsEmpty()) {
+                    useGPU = !willReadFrequentlyValue.ToLocalChecked()->
+                            BooleanValue(env->context()).FromMaybe(false);
+                }
+                auto deferredValue = env->getValue(contextAttributes, "deferred");
+                if (!deferredValue.IsEmpty()) {
+                    deferred = deferredValue.ToLocalChecked()->BooleanValue(env->context()).FromMaybe(false);
+                }
+                auto tiledRasterValue = env->getValue(contextAttributes, "tiledRaster");
+                if (!tiledRasterValue.IsEmpty()) {
+                    tiledRaster = tiledRasterValue.ToLocalChecked()->BooleanValue(env->context()).FromMaybe(false);
+                }
+                colorType = toColorType(env->getStdString(contextAttributes, "colorType"));
+                // Skia cannot render into gray pixels.
+                if (colorType == kGray_8_SkColorType) {
+                    colorType = kN32_SkColorType;
                 }
-                canvas->buffer = new OffScreenBuffer(canvas->width(), canvas->height(), hasAlpha, useGPU);
             }
-            canvas->context = new CanvasRenderingContext2D(canvas->buffer);
+            if (!canvas->buffer) {
+                canvas->buffer = new OffScreenBuffer(canvas->width(), canvas->height(), hasAlpha, useGPU,
+                                                     tiledRaster, colorType);
+            }
+            canvas->context = new CanvasRenderingContext2D(canvas->buffer, deferred);
             auto contextObject = env->newInstance(CanvasRenderingContext2DClass,
                                                   env->makeExternal(canvas->context)).ToLocalChecked();
             canvas->contextObject.Reset(env->isolate(), contextObject);
@@ -106,6 +130,9 @@ namespace cyder {
         auto self = args.This();
         auto canvas = static_cast<Canvas*>(self->GetAlignedPointerFromInternalField(0));
         Image* image;
+        if (canvas->context) {
+            canvas->context->flush();
+        }
         if (canvas->buffer) {
             image = canvas->buffer->makeImageSnapshot();
         } else {
@@ -119,6 +146,18 @@ namespace cyder {
         args.GetReturnValue().Set(imageObject);
     }
 
+    static void getDamageRectMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        auto self = args.This();
+        auto canvas = static_cast<Canvas*>(self->GetAlignedPointerFromInternalField(0));
+        auto rect = canvas->buffer ? canvas->buffer->damageRect() : SkIRect::MakeEmpty();
+        auto RectangleClass = env->readGlobalFunction("Rectangle");
+        auto rectObject = env->newInstance(RectangleClass, env->makeValue(rect.x()), env->makeValue(rect.y()),
+                                           env->makeValue(rect.width()), env->makeValue(rect.height())).ToLocalChecked();
+        args.GetReturnValue().Set(rectObject);
+    }
+
     static void constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
         auto env = Environment::GetCurrent(args);
         v8::HandleScope scope(env->isolate());
@@ -142,8 +181,10 @@ namespace cyder {
         auto prototypeTemplate = classTemplate->PrototypeTemplate();
         env->setTemplateAccessor(prototypeTemplate, "width", widthGetter, widthSetter);
         env->setTemplateAccessor(prototypeTemplate, "height", heightGetter, heightSetter);
+        env->setTemplateProperty(prototypeTemplate, "resize", resizeMethod);
         env->setTemplateProperty(prototypeTemplate, "getContext", getContextMethod);
         env->setTemplateProperty(prototypeTemplate, "makeImageSnapshot", makeImageSnapshotMethod);
+        env->setTemplateProperty(prototypeTemplate, "getDamageRect", getDamageRectMethod);
         env->attachClass(parent, "Canvas", classTemplate);
     }
 }
\ No newline at end of file
@@ -25,10 +25,19 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "V8CanvasRenderingContext2D.h"
+#include "V8Path2D.h"
+#include "V8PathMethods.h"
 #include "modules/canvas2d/CanvasRenderingContext2D.h"
+#include "modules/canvas2d/CanvasCommandBuffer.h"
+#include "modules/canvas2d/CSSColor.h"
+#include <algorithm>
 #include <skia.h>
 
 namespace cyder {
+    static CanvasRenderingContext2D* getContext(v8::Local<v8::Object> self) {
+        return static_cast<CanvasRenderingContext2D*>(self->GetAlignedPointerFromInternalField(0));
+    }
+
     static void drawImageMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
         auto env = Environment::GetCurrent(args);
         v8::HandleScope scope(env->isolate());
@@ -53,6 +62,579 @@ namespace cyder {
                            env->toFloat(args[8]));
     }
 
+    template<typename T>
+    static T* typedArrayData(v8::Local<v8::TypedArray> array) {
+        auto data = static_cast<char*>(array->Buffer()->GetContents().Data()) + array->ByteOffset();
+        return reinterpret_cast<T*>(data);
+    }
+
+    static void drawImagesMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        auto self = args.This();
+        auto context = static_cast<CanvasRenderingContext2D*>(self->GetAlignedPointerFromInternalField(0));
+        if (!args[0]->IsObject()) {
+            env->throwError(ErrorType::TYPE_ERROR, "The image argument must be a CanvasImageSource.");
+            return;
+        }
+        auto imageObject = v8::Local<v8::Object>::Cast(args[0]);
+        if (imageObject->InternalFieldCount() < 1) {
+            env->throwError(ErrorType::TYPE_ERROR, "The image argument must be a CanvasImageSource.");
+            return;
+        }
+        auto image = static_cast<CanvasImageSource*>(imageObject->GetAlignedPointerFromInternalField(0));
+        if (!image) {
+            return;
+        }
+        if (!args[1]->IsFloat32Array() || !args[2]->IsFloat32Array()) {
+            env->throwError(ErrorType::TYPE_ERROR, "The sourceRects and targetTransforms must be Float32Arrays.");
+            return;
+        }
+        auto sourceRects = v8::Local<v8::Float32Array>::Cast(args[1]);
+        auto targetTransforms = v8::Local<v8::Float32Array>::Cast(args[2]);
+        auto count = std::min(sourceRects->Length(), targetTransforms->Length()) / 4;
+        const SkColor* colors = nullptr;
+        if (!args[3]->IsUndefined() && !args[3]->IsNull()) {
+            if (!args[3]->IsUint32Array()) {
+                env->throwError(ErrorType::TYPE_ERROR, "The colors must be an Uint32Array.");
+                return;
+            }
+            auto colorArray = v8::Local<v8::Uint32Array>::Cast(args[3]);
+            if (colorArray->Length() < count) {
+                env->throwError(ErrorType::RANGE_ERROR, "The colors must contain one color for each sprite.");
+                return;
+            }
+            colors = typedArrayData<SkColor>(colorArray);
+        }
+        context->drawImages(image, typedArrayData<float>(sourceRects), typedArrayData<float>(targetTransforms),
+                            colors, static_cast<int>(count));
+    }
+
+    /**
+     * Normalizes a rectangle given by a possibly negative width and height.
+     */
+    static SkIRect makeSourceRect(int x, int y, int width, int height) {
+        if (width < 0) {
+            x += width;
+            width = -width;
+        }
+        if (height < 0) {
+            y += height;
+            height = -height;
+        }
+        return SkIRect::MakeXYWH(x, y, width, height);
+    }
+
+    /**
+     * Returns the Uint8ClampedArray of an ImageData object if it holds at least 4 * width * height bytes.
+     */
+    static bool readImageData(v8::Local<v8::Value> value, int* width, int* height, uint8_t** pixels, Environment* env) {
+        if (!value->IsObject()) {
+            return false;
+        }
+        auto imageData = v8::Local<v8::Object>::Cast(value);
+        *width = env->getInt(imageData, "width");
+        *height = env->getInt(imageData, "height");
+        if (*width <= 0 || *height <= 0) {
+            return false;
+        }
+        auto maybeData = env->getObject(imageData, "data");
+        if (maybeData.IsEmpty() || !maybeData.ToLocalChecked()->IsUint8ClampedArray()) {
+            return false;
+        }
+        auto data = v8::Local<v8::Uint8ClampedArray>::Cast(maybeData.ToLocalChecked());
+        if (data->Length() < static_cast<size_t>(*width) * *height * 4) {
+            return false;
+        }
+        *pixels = typedArrayData<uint8_t>(data);
+        return true;
+    }
+
+    static void getImageDataMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        auto rect = makeSourceRect(env->toInt(args[0]), env->toInt(args[1]), env->toInt(args[2]),
+                                   env->toInt(args[3]));
+        if (rect.isEmpty()) {
+            env->throwError(ErrorType::RANGE_ERROR, "IndexSizeError: The source width or height is 0.");
+            return;
+        }
+        size_t byteSize = static_cast<size_t>(rect.width()) * rect.height() * 4;
+        auto arrayBuffer = env->makeArrayBuffer(byteSize);
+        auto pixels = arrayBuffer->GetContents().Data();
+        getContext(args.This())->getImageData(rect.x(), rect.y(), rect.width(), rect.height(), pixels);
+        auto data = v8::Uint8ClampedArray::New(arrayBuffer, 0, byteSize);
+        auto ImageData = env->readGlobalFunction("ImageData");
+        auto result = env->newInstance(ImageData, data, env->makeValue(rect.width()),
+                                       env->makeValue(rect.height())).ToLocalChecked();
+        args.GetReturnValue().Set(result);
+    }
+
+    static void getImageDataIntoMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        int width, height;
+        uint8_t* pixels;
+        if (!readImageData(args[0], &width, &height, &pixels, env)) {
+            env->throwError(ErrorType::TYPE_ERROR, "The imageData argument must be a valid ImageData.");
+            return;
+        }
+        getContext(args.This())->getImageData(env->toInt(args[1]), env->toInt(args[2]), width, height, pixels);
+    }
+
+    static void putImageDataMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        int width, height;
+        uint8_t* pixels;
+        if (!readImageData(args[0], &width, &height, &pixels, env)) {
+            env->throwError(ErrorType::TYPE_ERROR, "The imageData argument must be a valid ImageData.");
+            return;
+        }
+        auto dirtyRect = SkIRect::MakeWH(width, height);
+        if (args.Length() >= 7) {
+            dirtyRect = makeSourceRect(env->toInt(args[3]), env->toInt(args[4]), env->toInt(args[5]),
+                                       env->toInt(args[6]));
+        }
+        getContext(args.This())->putImageData(pixels, width, height, env->toInt(args[1]), env->toInt(args[2]),
+                                              dirtyRect);
+    }
+
+    static void executeCommandsMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        if (!args[0]->IsArrayBuffer()) {
+            env->throwError(ErrorType::TYPE_ERROR, "The commands must be an ArrayBuffer.");
+            return;
+        }
+        auto buffer = v8::Local<v8::ArrayBuffer>::Cast(args[0]);
+        auto contents = buffer->GetContents();
+        auto length = static_cast<size_t>(env->toInt(args[1]));
+        if (length > contents.ByteLength() / 4) {
+            env->throwError(ErrorType::RANGE_ERROR, "The command length exceeds the size of the buffer.");
+            return;
+        }
+        std::vector<CanvasImageSource*> images;
+        if (args[2]->IsArray()) {
+            auto imageArray = v8::Local<v8::Array>::Cast(args[2]);
+            auto imageCount = imageArray->Length();
+            images.reserve(imageCount);
+            for (uint32_t i = 0; i < imageCount; i++) {
+                v8::Local<v8::Value> value;
+                if (!imageArray->Get(env->context(), i).ToLocal(&value)) {
+                    return;
+                }
+                CanvasImageSource* image = nullptr;
+                if (value->IsObject()) {
+                    auto imageObject = v8::Local<v8::Object>::Cast(value);
+                    if (imageObject->InternalFieldCount() > 0) {
+                        image = static_cast<CanvasImageSource*>(imageObject->GetAlignedPointerFromInternalField(0));
+                    }
+                }
+                images.push_back(image);
+            }
+        }
+        auto context = getContext(args.This());
+        if (!CanvasCommandBuffer::Execute(context, contents.Data(), length, images)) {
+            env->throwError(ErrorType::TYPE_ERROR, "The command buffer contains an invalid command.");
+        }
+    }
+
+    static void flushMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto self = args.This();
+        auto context = static_cast<CanvasRenderingContext2D*>(self->GetAlignedPointerFromInternalField(0));
+        context->flush();
+    }
+
+    static void replayLastFrameMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto self = args.This();
+        auto context = static_cast<CanvasRenderingContext2D*>(self->GetAlignedPointerFromInternalField(0));
+        args.GetReturnValue().Set(context->replayLastFrame());
+    }
+
+    static Path2D* getCurrentPath(v8::Local<v8::Object> self) {
+        return getContext(self)->currentPath();
+    }
+
+    struct CompositeOperation {
+        const char* name;
+        SkBlendMode mode;
+    };
+
+    static const CompositeOperation compositeOperations[] = {
+            {"source-over",      SkBlendMode::kSrcOver},
+            {"source-in",        SkBlendMode::kSrcIn},
+            {"source-out",       SkBlendMode::kSrcOut},
+            {"source-atop",      SkBlendMode::kSrcATop},
+            {"destination-over", SkBlendMode::kDstOver},
+            {"destination-in",   SkBlendMode::kDstIn},
+            {"destination-out",  SkBlendMode::kDstOut},
+            {"destination-atop", SkBlendMode::kDstATop},
+            {"lighter",          SkBlendMode::kPlus},
+            {"copy",             SkBlendMode::kSrc},
+            {"xor",              SkBlendMode::kXor},
+            {"multiply",         SkBlendMode::kMultiply},
+            {"screen",           SkBlendMode::kScreen},
+            {"overlay",          SkBlendMode::kOverlay},
+            {"darken",           SkBlendMode::kDarken},
+            {"lighten",          SkBlendMode::kLighten},
+            {"color-dodge",      SkBlendMode::kColorDodge},
+            {"color-burn",       SkBlendMode::kColorBurn},
+            {"hard-light",       SkBlendMode::kHardLight},
+            {"soft-light",       SkBlendMode::kSoftLight},
+            {"difference",       SkBlendMode::kDifference},
+            {"exclusion",        SkBlendMode::kExclusion},
+            {"hue",              SkBlendMode::kHue},
+            {"saturation",       SkBlendMode::kSaturation},
+            {"color",            SkBlendMode::kColor},
+            {"luminosity",       SkBlendMode::kLuminosity}
+    };
+
+    static void globalAlphaGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        args.GetReturnValue().Set(getContext(args.This())->globalAlpha());
+    }
+
+    static void globalAlphaSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                  const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->setGlobalAlpha(env->toFloat(value));
+    }
+
+    static void globalCompositeOperationGetter(v8::Local<v8::Name> property,
+                                               const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto mode = getContext(args.This())->globalCompositeOperation();
+        for (auto& operation : compositeOperations) {
+            if (operation.mode == mode) {
+                args.GetReturnValue().Set(env->makeString(operation.name).ToLocalChecked());
+                return;
+            }
+        }
+    }
+
+    static void globalCompositeOperationSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                               const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto name = env->toStdString(value);
+        for (auto& operation : compositeOperations) {
+            if (name == operation.name) {
+                getContext(args.This())->setGlobalCompositeOperation(operation.mode);
+                return;
+            }
+        }
+    }
+
+    static void imageSmoothingEnabledGetter(v8::Local<v8::Name> property,
+                                            const v8::PropertyCallbackInfo<v8::Value>& args) {
+        args.GetReturnValue().Set(getContext(args.This())->imageSmoothingEnabled());
+    }
+
+    static void imageSmoothingEnabledSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                            const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->setImageSmoothingEnabled(env->toBoolean(value));
+    }
+
+    static void saveMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        getContext(args.This())->save();
+    }
+
+    static void restoreMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        getContext(args.This())->restore();
+    }
+
+    static void setTransformMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->setTransform(env->toFloat(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                              env->toFloat(args[3]), env->toFloat(args[4]), env->toFloat(args[5]));
+    }
+
+    static void transformMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->transform(env->toFloat(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                           env->toFloat(args[3]), env->toFloat(args[4]), env->toFloat(args[5]));
+    }
+
+    static void resetTransformMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        getContext(args.This())->resetTransform();
+    }
+
+    static void translateMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->translate(env->toFloat(args[0]), env->toFloat(args[1]));
+    }
+
+    static void rotateMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->rotate(env->toFloat(args[0]));
+    }
+
+    static void scaleMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->scale(env->toFloat(args[0]), env->toFloat(args[1]));
+    }
+
+    static void fillStyleGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto context = getContext(args.This());
+        args.GetReturnValue().Set(env->makeString(CSSColor::Serialize(context->fillStyle())).ToLocalChecked());
+    }
+
+    static void fillStyleSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        SkColor color;
+        if (value->IsString() && CSSColor::Parse(env->toStdString(value), &color)) {
+            getContext(args.This())->setFillStyle(color);
+        }
+    }
+
+    static void strokeStyleGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto context = getContext(args.This());
+        args.GetReturnValue().Set(env->makeString(CSSColor::Serialize(context->strokeStyle())).ToLocalChecked());
+    }
+
+    static void strokeStyleSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                  const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        SkColor color;
+        if (value->IsString() && CSSColor::Parse(env->toStdString(value), &color)) {
+            getContext(args.This())->setStrokeStyle(color);
+        }
+    }
+
+    static void lineWidthGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        args.GetReturnValue().Set(getContext(args.This())->lineWidth());
+    }
+
+    static void lineWidthSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->setLineWidth(env->toFloat(value));
+    }
+
+    static void lineCapGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        const char* name;
+        switch (getContext(args.This())->lineCap()) {
+            case SkPaint::kRound_Cap:
+                name = "round";
+                break;
+            case SkPaint::kSquare_Cap:
+                name = "square";
+                break;
+            default:
+                name = "butt";
+                break;
+        }
+        args.GetReturnValue().Set(env->makeString(name).ToLocalChecked());
+    }
+
+    static void lineCapSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                              const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto context = getContext(args.This());
+        auto name = env->toStdString(value);
+        if (name == "butt") {
+            context->setLineCap(SkPaint::kButt_Cap);
+        } else if (name == "round") {
+            context->setLineCap(SkPaint::kRound_Cap);
+        } else if (name == "square") {
+            context->setLineCap(SkPaint::kSquare_Cap);
+        }
+    }
+
+    static void lineJoinGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        const char* name;
+        switch (getContext(args.This())->lineJoin()) {
+            case SkPaint::kRound_Join:
+                name = "round";
+                break;
+            case SkPaint::kBevel_Join:
+                name = "bevel";
+                break;
+            default:
+                name = "miter";
+                break;
+        }
+        args.GetReturnValue().Set(env->makeString(name).ToLocalChecked());
+    }
+
+    static void lineJoinSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                               const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto context = getContext(args.This());
+        auto name = env->toStdString(value);
+        if (name == "miter") {
+            context->setLineJoin(SkPaint::kMiter_Join);
+        } else if (name == "round") {
+            context->setLineJoin(SkPaint::kRound_Join);
+        } else if (name == "bevel") {
+            context->setLineJoin(SkPaint::kBevel_Join);
+        }
+    }
+
+    static void miterLimitGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        args.GetReturnValue().Set(getContext(args.This())->miterLimit());
+    }
+
+    static void miterLimitSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                 const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->setMiterLimit(env->toFloat(value));
+    }
+
+    static void fontGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto font = getContext(args.This())->font();
+        args.GetReturnValue().Set(env->makeString(font->text()).ToLocalChecked());
+    }
+
+    static void fontSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                           const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto font = Font::Get(env->toStdString(value));
+        if (font) {
+            getContext(args.This())->setFont(std::move(font));
+        }
+    }
+
+    static const char* textAlignNames[] = {"start", "end", "left", "right", "center"};
+
+    static void textAlignGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto textAlign = getContext(args.This())->textAlign();
+        args.GetReturnValue().Set(env->makeString(textAlignNames[static_cast<int>(textAlign)]).ToLocalChecked());
+    }
+
+    static void textAlignSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto name = env->toStdString(value);
+        for (size_t i = 0; i < sizeof(textAlignNames) / sizeof(textAlignNames[0]); i++) {
+            if (name == textAlignNames[i]) {
+                getContext(args.This())->setTextAlign(static_cast<TextAlign>(i));
+                return;
+            }
+        }
+    }
+
+    static const char* textBaselineNames[] = {"alphabetic", "top", "hanging", "middle", "ideographic", "bottom"};
+
+    static void textBaselineGetter(v8::Local<v8::Name> property, const v8::PropertyCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto textBaseline = getContext(args.This())->textBaseline();
+        args.GetReturnValue().Set(env->makeString(textBaselineNames[static_cast<int>(textBaseline)]).ToLocalChecked());
+    }
+
+    static void textBaselineSetter(v8::Local<v8::Name> property, v8::Local<v8::Value> value,
+                                   const v8::PropertyCallbackInfo<void>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto name = env->toStdString(value);
+        for (size_t i = 0; i < sizeof(textBaselineNames) / sizeof(textBaselineNames[0]); i++) {
+            if (name == textBaselineNames[i]) {
+                getContext(args.This())->setTextBaseline(static_cast<TextBaseline>(i));
+                return;
+            }
+        }
+    }
+
+    static void fillTextMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto maxWidth = args[3]->IsUndefined() ? SK_ScalarInfinity : env->toFloat(args[3]);
+        getContext(args.This())->fillText(env->toStdString(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                          maxWidth);
+    }
+
+    static void strokeTextMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto maxWidth = args[3]->IsUndefined() ? SK_ScalarInfinity : env->toFloat(args[3]);
+        getContext(args.This())->strokeText(env->toStdString(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                            maxWidth);
+    }
+
+    static void measureTextMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        TextMetrics metrics;
+        getContext(args.This())->measureText(env->toStdString(args[0]), &metrics);
+        auto result = env->makeObject();
+        env->setObjectProperty(result, "width", metrics.width);
+        env->setObjectProperty(result, "actualBoundingBoxLeft", metrics.actualBoundingBoxLeft);
+        env->setObjectProperty(result, "actualBoundingBoxRight", metrics.actualBoundingBoxRight);
+        env->setObjectProperty(result, "actualBoundingBoxAscent", metrics.actualBoundingBoxAscent);
+        env->setObjectProperty(result, "actualBoundingBoxDescent", metrics.actualBoundingBoxDescent);
+        env->setObjectProperty(result, "fontBoundingBoxAscent", metrics.fontBoundingBoxAscent);
+        env->setObjectProperty(result, "fontBoundingBoxDescent", metrics.fontBoundingBoxDescent);
+        args.GetReturnValue().Set(result);
+    }
+
+    static void beginPathMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        getContext(args.This())->beginPath();
+    }
+
+    static void fillMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        auto context = getContext(args.This());
+        const Path2D* path = nullptr;
+        auto fillRuleIndex = 0;
+        if (args[0]->IsObject()) {
+            path = V8Path2D::ToPath2D(args[0]);
+            if (!path) {
+                env->throwError(ErrorType::TYPE_ERROR, "The path argument must be a Path2D.");
+                return;
+            }
+            fillRuleIndex = 1;
+        }
+        auto fillType = SkPath::kWinding_FillType;
+        if (!args[fillRuleIndex]->IsUndefined()) {
+            auto fillRule = env->toStdString(args[fillRuleIndex]);
+            if (fillRule == "evenodd") {
+                fillType = SkPath::kEvenOdd_FillType;
+            } else if (fillRule != "nonzero") {
+                env->throwError(ErrorType::TYPE_ERROR, "The fillRule must be either 'nonzero' or 'evenodd'.");
+                return;
+            }
+        }
+        context->fill(path, fillType);
+    }
+
+    static void strokeMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        auto context = getContext(args.This());
+        const Path2D* path = nullptr;
+        if (!args[0]->IsUndefined()) {
+            path = V8Path2D::ToPath2D(args[0]);
+            if (!path) {
+                env->throwError(ErrorType::TYPE_ERROR, "The path argument must be a Path2D.");
+                return;
+            }
+        }
+        context->stroke(path);
+    }
+
+    static void fillRectMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->fillRect(env->toFloat(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                          env->toFloat(args[3]));
+    }
+
+    static void strokeRectMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->strokeRect(env->toFloat(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                            env->toFloat(args[3]));
+    }
+
+    static void clearRectMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        getContext(args.This())->clearRect(env->toFloat(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                           env->toFloat(args[3]));
+    }
+
     static void constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
         auto env = Environment::GetCurrent(args);
         v8::HandleScope scope(env->isolate());
@@ -69,7 +651,46 @@ namespace cyder {
     void V8CanvasRenderingContext2D::install(v8::Local<v8::Object> parent, Environment* env) {
         auto classTemplate = env->makeFunctionTemplate(constructor);
         auto prototypeTemplate = classTemplate->PrototypeTemplate();
+        env->setTemplateAccessor(prototypeTemplate, "globalAlpha", globalAlphaGetter, globalAlphaSetter);
+        env->setTemplateAccessor(prototypeTemplate, "globalCompositeOperation", globalCompositeOperationGetter,
+                                 globalCompositeOperationSetter);
+        env->setTemplateAccessor(prototypeTemplate, "imageSmoothingEnabled", imageSmoothingEnabledGetter,
+                                 imageSmoothingEnabledSetter);
+        env->setTemplateAccessor(prototypeTemplate, "fillStyle", fillStyleGetter, fillStyleSetter);
+        env->setTemplateAccessor(prototypeTemplate, "strokeStyle", strokeStyleGetter, strokeStyleSetter);
+        env->setTemplateAccessor(prototypeTemplate, "lineWidth", lineWidthGetter, lineWidthSetter);
+        env->setTemplateAccessor(prototypeTemplate, "lineCap", lineCapGetter, lineCapSetter);
+        env->setTemplateAccessor(prototypeTemplate, "lineJoin", lineJoinGetter, lineJoinSetter);
+        env->setTemplateAccessor(prototypeTemplate, "miterLimit", miterLimitGetter, miterLimitSetter);
+        env->setTemplateAccessor(prototypeTemplate, "font", fontGetter, fontSetter);
+        env->setTemplateAccessor(prototypeTemplate, "textAlign", textAlignGetter, textAlignSetter);
+        env->setTemplateAccessor(prototypeTemplate, "textBaseline", textBaselineGetter, textBaselineSetter);
+        env->setTemplateProperty(prototypeTemplate, "save", saveMethod);
+        env->setTemplateProperty(prototypeTemplate, "restore", restoreMethod);
+        env->setTemplateProperty(prototypeTemplate, "setTransform", setTransformMethod);
+        env->setTemplateProperty(prototypeTemplate, "transform", transformMethod);
+        env->setTemplateProperty(prototypeTemplate, "resetTransform", resetTransformMethod);
+        env->setTemplateProperty(prototypeTemplate, "translate", translateMethod);
+        env->setTemplateProperty(prototypeTemplate, "rotate", rotateMethod);
+        env->setTemplateProperty(prototypeTemplate, "scale", scaleMethod);
+        env->setTemplateProperty(prototypeTemplate, "beginPath", beginPathMethod);
+        env->setTemplateProperty(prototypeTemplate, "fill", fillMethod);
+        env->setTemplateProperty(prototypeTemplate, "stroke", strokeMethod);
+        env->setTemplateProperty(prototypeTemplate, "fillRect", fillRectMethod);
+        env->setTemplateProperty(prototypeTemplate, "strokeRect", strokeRectMethod);
+        env->setTemplateProperty(prototypeTemplate, "clearRect", clearRectMethod);
+        V8PathMethods<getCurrentPath>::install(prototypeTemplate, env);
+        env->setTemplateProperty(prototypeTemplate, "fillText", fillTextMethod);
+        env->setTemplateProperty(prototypeTemplate, "strokeText", strokeTextMethod);
+        env->setTemplateProperty(prototypeTemplate, "measureText", measureTextMethod);
         env->setTemplateProperty(prototypeTemplate, "drawImage", drawImageMethod);
+        env->setTemplateProperty(prototypeTemplate, "drawImages", drawImagesMethod);
+        env->setTemplateProperty(prototypeTemplate, "getImageData", getImageDataMethod);
+        env->setTemplateProperty(prototypeTemplate, "getImageDataInto", getImageDataIntoMethod);
+        env->setTemplateProperty(prototypeTemplate, "putImageData", putImageDataMethod);
+        env->setTemplateProperty(prototypeTemplate, "executeCommands", executeCommandsMethod);
+        env->setTemplateProperty(prototypeTemplate, "flush", flushMethod);
+        env->setTemplateProperty(prototypeTemplate, "replayLastFrame", replayLastFrameMethod);
         env->attachClass(parent, "CanvasRenderingContext2D", classTemplate);
     }
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "V8File.h"
+#include "base/Globals.h"
+#include "platform/MappedFile.h"
+
+namespace cyder {
+
+    static void readFileMappedMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        if (!args[0]->IsString()) {
+            env->throwError(ErrorType::TYPE_ERROR,
+                            "Failed to execute 'readFileMapped': parameter 1 is not of type 'string'.");
+            return;
+        }
+        auto file = MappedFile::Open(Globals::resolvePath(env->toStdString(args[0])));
+        if (!file) {
+            args.GetReturnValue().Set(env->makeNull());
+            return;
+        }
+        if (file->size() == 0) {
+            delete file;
+            args.GetReturnValue().Set(env->makeArrayBuffer(0));
+            return;
+        }
+        // The mapping is released when the ArrayBuffer is garbage collected.
+        auto arrayBuffer = env->makeArrayBuffer(file->data(), file->size());
+        env->bind(arrayBuffer, file);
+        args.GetReturnValue().Set(arrayBuffer);
+    }
+
+    void V8File::install(v8::Local<v8::Object> parent, Environment* env) {
+        auto cyderScope = env->readGlobalObject("cyder");
+        env->setObjectProperty(cyderScope, "readFileMapped", readFileMappedMethod);
+    }
+}
@@ -51,6 +51,99 @@ namespace cyder {
         return format;
     }
 
+    struct PNGFilterName {
+        const char* name;
+        PNGFilter filter;
+    };
+
+    static const PNGFilterName pngFilterNames[] = {
+            {"none",     PNGFilter::NONE},
+            {"sub",      PNGFilter::SUB},
+            {"up",       PNGFilter::UP},
+            {"average",  PNGFilter::AVERAGE},
+            {"paeth",    PNGFilter::PAETH},
+            {"adaptive", PNGFilter::ADAPTIVE}
+    };
+
+    static bool readOption(const v8::Local<v8::Object>& object, const std::string& name, v8::Local<v8::Value>* value,
+                           Environment* env) {
+        return env->getValue(object, name).ToLocal(value) && !(*value)->IsUndefined();
+    }
+
+    /**
+     * Reads the encoder options argument, which is either a quality number or an object with the quality,
+     * compressionLevel, filter and parallel properties. For PNG, a quality number picks a preset between the fastest
+     * (0) and the smallest (1) encoding.
+     */
+    static EncodeOptions toEncodeOptions(const std::string& mimeType, const v8::Local<v8::Value>& value,
+                                         Environment* env) {
+        EncodeOptions options;
+        options.format = toImageFormat(mimeType);
+        if (value->IsNumber()) {
+            options.quality = env->toDouble(value);
+            if (options.format == ImageFormat::PNG && options.quality >= 0 && options.quality <= 1) {
+                options.compressionLevel = static_cast<int>(options.quality * 9 + 0.5);
+                options.filter = options.compressionLevel <= 2 ? PNGFilter::SUB : PNGFilter::ADAPTIVE;
+            }
+            return options;
+        }
+        if (!value->IsObject()) {
+            return options;
+        }
+        auto object = v8::Local<v8::Object>::Cast(value);
+        v8::Local<v8::Value> option;
+        if (readOption(object, "quality", &option, env)) {
+            options.quality = env->toDouble(option);
+        }
+        if (readOption(object, "compressionLevel", &option, env)) {
+            options.compressionLevel = env->toInt(option);
+        }
+        if (readOption(object, "filter", &option, env)) {
+            auto filter = env->toStdString(option);
+            for (auto& filterName : pngFilterNames) {
+                if (filter == filterName.name) {
+                    options.filter = filterName.filter;
+                    break;
+                }
+            }
+        }
+        if (readOption(object, "parallel", &option, env)) {
+            options.parallel = env->toBoolean(option);
+        }
+        return options;
+    }
+
+    /**
+     * Wraps the encoded bytes in an ArrayBuffer without copying them. Takes over the reference to bytes.
+     */
+    static v8::Local<v8::Value> wrapEncodedData(SkData* bytes, Environment* env) {
+        if (!bytes || bytes->size() == 0) {
+            SkSafeUnref(bytes);
+            return env->makeNull();
+        }
+        auto arrayBuffer = env->makeArrayBuffer(bytes->writable_data(), bytes->size());
+        env->bind(arrayBuffer, SkUnref::Wrap(bytes));
+        return arrayBuffer;
+    }
+
+    static v8::Local<v8::Value> makeDataURL(const std::string& mimeType, SkData* bytes, Environment* env) {
+        if (!bytes || bytes->size() == 0) {
+            return env->makeString("data:,").ToLocalChecked();
+        }
+        auto data = reinterpret_cast<char*>(bytes->writable_data());
+        auto textLength = Base64::EncodeLength(bytes->size());
+        auto base64Buffer = new char[textLength + 1];
+        Base64::Encode(data, bytes->size(), base64Buffer);
+        base64Buffer[textLength] = '\0';
+        std::string url = "data:" + mimeType + ";base64," + base64Buffer;
+        delete[] base64Buffer;
+        auto maybeURLObject = env->makeString(url);
+        if (maybeURLObject.IsEmpty()) {
+            return env->makeString("data:,").ToLocalChecked();
+        }
+        return maybeURLObject.ToLocalChecked();
+    }
+
     static void disposeMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
         auto env = Environment::GetCurrent(args);
         auto self = args.This();
@@ -74,15 +167,8 @@ namespace cyder {
             return;
         }
         std::string type = formatImageMimeType(env->toStdString(args[0]));
-        auto quality = args[1]->IsUndefined() ? -1 : env->toDouble(args[1]);
-        auto bytes = image->encode(toImageFormat(type), quality);
-        if (!bytes || bytes->size() == 0) {
-            args.GetReturnValue().Set(env->makeNull());
-            return;
-        }
-        auto arrayBuffer = env->makeArrayBuffer(bytes->writable_data(), bytes->size());
-        env->bind(arrayBuffer, SkUnref::Wrap(bytes));
-        args.GetReturnValue().Set(arrayBuffer);
+        auto bytes = image->encode(toEncodeOptions(type, args[1], env));
+        args.GetReturnValue().Set(wrapEncodedData(bytes, env));
     }
 
     static void getImageDataMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
@@ -141,25 +227,66 @@ namespace cyder {
             return;
         }
         std::string mimeType = formatImageMimeType(env->toStdString(args[0]));
-        auto quality = args[1]->IsUndefined() ? -1 : env->toDouble(args[1]);
-        auto bytes = image->encode(toImageFormat(mimeType), quality);
-        if (!bytes || bytes->size() == 0) {
-            args.GetReturnValue().Set(env->makeString("data:,").ToLocalChecked());
+        auto bytes = image->encode(toEncodeOptions(mimeType, args[1], env));
+        args.GetReturnValue().Set(makeDataURL(mimeType, bytes, env));
+        SkSafeUnref(bytes);
+    }
+
+    struct EncodeRequest {
+        Environment* env;
+        v8::Persistent<v8::Function> callback;
+        std::string mimeType;
+        bool dataURL;
+    };
+
+    static void onEncoded(EncodeRequest* request, SkData* bytes) {
+        auto env = request->env;
+        auto isolate = env->isolate();
+        v8::HandleScope scope(isolate);
+        v8::Context::Scope contextScope(env->context());
+        v8::TryCatch tryCatch(isolate);
+        auto callback = v8::Local<v8::Function>::New(isolate, request->callback);
+        v8::Local<v8::Value> result;
+        if (request->dataURL) {
+            result = makeDataURL(request->mimeType, bytes, env);
+            SkSafeUnref(bytes);
+        } else {
+            result = wrapEncodedData(bytes, env);
+        }
+        request->callback.Reset();
+        delete request;
+        if (env->call(callback, env->makeNull(), result).IsEmpty()) {
+            env->printStackTrace(tryCatch);
+            abort();
+        }
+    }
+
+    static void encodeAsync(const v8::FunctionCallbackInfo<v8::Value>& args, bool dataURL, const char* methodName) {
+        auto env = Environment::GetCurrent(args);
+        auto image = getInternalImage(args.This(), env);
+        if (!image) {
             return;
         }
-        auto data = reinterpret_cast<char*>(bytes->writable_data());
-        auto textLength = Base64::EncodeLength(bytes->size());
-        auto base64Buffer = new char[textLength + 1];
-        Base64::Encode(data, bytes->size(), base64Buffer);
-        base64Buffer[textLength] = '\0';
-        std::string url = "data:" + mimeType + ";base64," + base64Buffer;
-        auto maybeURLObject = env->makeString(url);
-        SkSafeUnref(bytes);
-        if (maybeURLObject.IsEmpty()) {
-            args.GetReturnValue().Set(env->makeString("data:,").ToLocalChecked());
+        if (!args[0]->IsFunction()) {
+            env->throwError(ErrorType::TYPE_ERROR, std::string("Failed to execute '") + methodName +
+                                                   "' on 'Image': parameter 1 is not of type 'Function'.");
             return;
         }
-        args.GetReturnValue().Set(maybeURLObject.ToLocalChecked());
+        auto request = new EncodeRequest();
+        request->env = env;
+        request->callback.Reset(env->isolate(), v8::Local<v8::Function>::Cast(args[0]));
+        request->mimeType = formatImageMimeType(env->toStdString(args[1]));
+        request->dataURL = dataURL;
+        auto options = toEncodeOptions(request->mimeType, args[2], env);
+        image->encodeAsync(options, std::bind(onEncoded, request, std::placeholders::_1));
+    }
+
+    static void encodeAsyncMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        encodeAsync(args, false, "encodeAsync");
+    }
+
+    static void toDataURLAsyncMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        encodeAsync(args, true, "toDataURLAsync");
     }
 
     static Image* createFromImageData(const v8::Local<v8::Object>& imageData, bool transparent, Environment* env) {
@@ -215,14 +342,34 @@ namespace cyder {
         self->SetAlignedPointerInInternalField(1, handle);
     }
 
+    static void setDecodedCacheLimitMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto bytes = env->toDouble(args[0]);
+        if (!(bytes >= 0)) {
+            env->throwError(ErrorType::RANGE_ERROR,
+                            "Failed to execute 'setDecodedCacheLimit' on 'Image': the limit must not be negative.");
+            return;
+        }
+        Image::SetDecodedCacheLimit(static_cast<size_t>(bytes));
+    }
+
+    static void getDecodedCacheUsageMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        args.GetReturnValue().Set(env->makeValue(static_cast<double>(Image::DecodedCacheUsage())));
+    }
+
     void V8Image::install(const v8::Local<v8::Object>& parent, Environment* env) {
         auto classTemplate = env->makeFunctionTemplate(constructor);
         auto prototypeTemplate = classTemplate->PrototypeTemplate();
         env->setTemplateProperty(prototypeTemplate, "dispose", disposeMethod);
         env->setTemplateProperty(prototypeTemplate, "encode", encodeMethod);
+        env->setTemplateProperty(prototypeTemplate, "encodeAsync", encodeAsyncMethod);
         env->setTemplateProperty(prototypeTemplate, "getImageData", getImageDataMethod);
         env->setTemplateProperty(prototypeTemplate, "makeSubset", makeSubsetMethod);
         env->setTemplateProperty(prototypeTemplate, "toDataURL", toDataURLMethod);
+        env->setTemplateProperty(prototypeTemplate, "toDataURLAsync", toDataURLAsyncMethod);
+        env->setTemplateProperty(classTemplate, "setDecodedCacheLimit", setDecodedCacheLimitMethod);
+        env->setTemplateProperty(classTemplate, "getDecodedCacheUsage", getDecodedCacheUsageMethod);
         env->attachClass(parent, "Image", classTemplate, 2);
     }
 
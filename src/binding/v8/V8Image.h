@@ -43,6 +43,23 @@ namespace cyder {
         return image;
     }
 
+    /**
+     * Converts the name of a color type, as given in the decode options of images and the context attributes of
+     * canvases. Unknown names give the native 32-bit type.
+     */
+    inline SkColorType toColorType(const std::string& name) {
+        if (name == "rgb565") {
+            return kRGB_565_SkColorType;
+        }
+        if (name == "alpha8") {
+            return kAlpha_8_SkColorType;
+        }
+        if (name == "gray8") {
+            return kGray_8_SkColorType;
+        }
+        return kN32_SkColorType;
+    }
+
     class V8Image {
     public:
         static void install(const v8::Local<v8::Object>& parent, Environment* env);
@@ -0,0 +1,90 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "V8ImageAtlas.h"
+#include "modules/image/ImageAtlas.h"
+
+namespace cyder {
+
+    static const int DEFAULT_PAGE_SIZE = 2048;
+    static const int DEFAULT_PADDING = 1;
+
+    static void constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        env->throwError(ErrorType::TYPE_ERROR, "Illegal constructor");
+    }
+
+    static void packMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        if (!args[0]->IsArray()) {
+            env->throwError(ErrorType::TYPE_ERROR,
+                            "Failed to execute 'pack' on 'ImageAtlas': parameter 1 is not of type 'Array'.");
+            return;
+        }
+        auto context = env->context();
+        auto array = v8::Local<v8::Array>::Cast(args[0]);
+        std::vector<CanvasImageSource*> sources;
+        for (uint32_t i = 0; i < array->Length(); i++) {
+            v8::Local<v8::Value> value;
+            CanvasImageSource* source = nullptr;
+            if (array->Get(context, i).ToLocal(&value) && value->IsObject()) {
+                auto object = v8::Local<v8::Object>::Cast(value);
+                if (object->InternalFieldCount() > 0) {
+                    source = static_cast<CanvasImageSource*>(object->GetAlignedPointerFromInternalField(0));
+                }
+            }
+            sources.push_back(source);
+        }
+        auto pageSize = args[1]->IsUndefined() ? DEFAULT_PAGE_SIZE : env->toInt(args[1]);
+        auto padding = args[2]->IsUndefined() ? DEFAULT_PADDING : env->toInt(args[2]);
+        if (pageSize <= 0 || padding < 0) {
+            env->throwError(ErrorType::RANGE_ERROR,
+                            "Failed to execute 'pack' on 'ImageAtlas': the page size must be positive and the padding "
+                            "must not be negative.");
+            return;
+        }
+        auto images = ImageAtlas::Pack(sources, pageSize, padding);
+        auto ImageClass = env->readGlobalFunction("Image");
+        auto result = env->makeArray(static_cast<int>(images.size()));
+        for (uint32_t i = 0; i < images.size(); i++) {
+            v8::Local<v8::Value> value = env->makeNull();
+            if (images[i]) {
+                value = env->newInstance(ImageClass, env->makeExternal(images[i])).ToLocalChecked();
+            }
+            auto setResult = result->Set(context, i, value);
+            USE(setResult);
+        }
+        args.GetReturnValue().Set(result);
+    }
+
+    void V8ImageAtlas::install(const v8::Local<v8::Object>& parent, Environment* env) {
+        auto classTemplate = env->makeFunctionTemplate(constructor);
+        env->setTemplateProperty(classTemplate, "pack", packMethod);
+        env->attachClass(parent, "ImageAtlas", classTemplate);
+    }
+
+}
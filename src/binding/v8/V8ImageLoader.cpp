@@ -26,88 +26,196 @@
 
 
 #include "V8ImageLoader.h"
-#include <fstream>
+#include "V8Image.h"
+#include <vector>
 #include "base/Globals.h"
 #include "utils/Base64.h"
-#include "modules/image/Image.h"
+#include "modules/image/ImageCache.h"
+#include "modules/image/DiskImageCache.h"
+#include "modules/image/ImageDecodeQueue.h"
+#include "platform/MainThread.h"
 
 namespace cyder {
 
-    static void loadImageFromURLMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
-        auto env = Environment::GetCurrent(args);
-        v8::HandleScope scope(env->isolate());
-        auto url = env->toStdString(args[0]);
-        auto callback = v8::Local<v8::Function>::Cast(args[1]);
-        auto thisArg = v8::Local<v8::Object>::Cast(args[2]);
-
-        char* buffer = nullptr;
-        size_t length = 0;
-        if (url.substr(0, 5) == "data:") {
-            auto pos = url.find(",");
-            if (pos != std::string::npos && pos != 5) {
-                const char* data = url.c_str() + pos + 1;
-                size_t textLength = static_cast<size_t>(url.size() - pos - 1);
-                length = Base64::DecodeLength(textLength);
-                if (length > 0) {
-                    buffer = new char[length];
-                    Base64::Decode(data, textLength, buffer);
-                }
-            }
-        }
-        if (!buffer) {
-            url = Globals::resolvePath(url);
-            std::ifstream t;
-            t.open(url);
-            t.seekg(0, std::ios::end);
-            auto fileSize = t.tellg();
-            if (fileSize > 0) {
-                length = static_cast<size_t>(fileSize);
-                t.seekg(0, std::ios::beg);
-                buffer = new char[length];
-                t.read(buffer, length);
-            }
-            t.close();
+    static ImageDecodeOptions toDecodeOptions(const v8::Local<v8::Value>& value, Environment* env) {
+        ImageDecodeOptions options;
+        if (value->IsObject()) {
+            auto object = v8::Local<v8::Object>::Cast(value);
+            options.maxWidth = env->getInt(object, "maxWidth");
+            options.maxHeight = env->getInt(object, "maxHeight");
+            options.lazy = env->getBoolean(object, "lazy");
+            options.progressive = env->getBoolean(object, "progressive");
+            options.colorType = toColorType(env->getStdString(object, "colorType"));
         }
+        return options;
+    }
 
-        if (!buffer) {
-            env->call(callback, thisArg, env->makeNull());
-            return;
-        }
+    struct LoadRequest {
+        Environment* env;
+        v8::Persistent<v8::Function> callback;
+        v8::Persistent<v8::Object> thisArg;
+        v8::Persistent<v8::Function> progressCallback;
+    };
+
+    typedef std::function<Image*(const Image::DecodeProgress& progress)> LoadFunction;
 
-        auto image = Image::Decode(buffer, length);
-        delete[] buffer;
+    static v8::Local<v8::Value> wrapImage(Image* image, Environment* env) {
         if (!image) {
-            env->call(callback, thisArg, env->makeNull());
-            return;
+            return env->makeNull();
         }
         auto ImageClass = env->readGlobalFunction("Image");
-        auto imageObject = env->newInstance(ImageClass, env->makeExternal(image)).ToLocalChecked();
-        env->call(callback, thisArg, imageObject);
+        return env->newInstance(ImageClass, env->makeExternal(image)).ToLocalChecked();
+    }
+
+    /**
+     * Runs on the main thread before onLoaded(), since both are queued there in order.
+     */
+    static void onProgress(LoadRequest* request, Image* image, int totalRows) {
+        auto env = request->env;
+        auto isolate = env->isolate();
+        v8::HandleScope scope(isolate);
+        v8::Context::Scope contextScope(env->context());
+        v8::TryCatch tryCatch(isolate);
+        auto callback = v8::Local<v8::Function>::New(isolate, request->progressCallback);
+        auto thisArg = v8::Local<v8::Object>::New(isolate, request->thisArg);
+        auto decodedRows = env->makeValue(image->height());
+        if (env->call(callback, thisArg, wrapImage(image, env), decodedRows, env->makeValue(totalRows)).IsEmpty()) {
+            env->printStackTrace(tryCatch);
+            abort();
+        }
+    }
+
+    static void onLoaded(LoadRequest* request, Image* image) {
+        auto env = request->env;
+        auto isolate = env->isolate();
+        v8::HandleScope scope(isolate);
+        v8::Context::Scope contextScope(env->context());
+        v8::TryCatch tryCatch(isolate);
+        auto callback = v8::Local<v8::Function>::New(isolate, request->callback);
+        auto thisArg = v8::Local<v8::Object>::New(isolate, request->thisArg);
+        request->callback.Reset();
+        request->thisArg.Reset();
+        request->progressCallback.Reset();
+        delete request;
+        if (env->call(callback, thisArg, wrapImage(image, env)).IsEmpty()) {
+            env->printStackTrace(tryCatch);
+            abort();
+        }
+    }
+
+    static void postLoad(const v8::FunctionCallbackInfo<v8::Value>& args, const LoadFunction& load, Environment* env) {
+        auto request = new LoadRequest();
+        request->env = env;
+        request->callback.Reset(env->isolate(), v8::Local<v8::Function>::Cast(args[1]));
+        request->thisArg.Reset(env->isolate(), v8::Local<v8::Object>::Cast(args[2]));
+        Image::DecodeProgress progress = nullptr;
+        if (args[4]->IsFunction()) {
+            request->progressCallback.Reset(env->isolate(), v8::Local<v8::Function>::Cast(args[4]));
+            progress = [request](Image* image, int totalRows) {
+                MainThread::Post(std::bind(onProgress, request, image, totalRows));
+            };
+        }
+        ImageDecodeQueue::Shared()->post([=]() {
+            return load(progress);
+        }, std::bind(onLoaded, request, std::placeholders::_1));
+    }
+
+    static Image* decodeDataURL(const std::string& url, const ImageDecodeOptions& options,
+                                const Image::DecodeProgress& progress) {
+        auto pos = url.find(",");
+        const char* data = url.c_str() + pos + 1;
+        size_t textLength = static_cast<size_t>(url.size() - pos - 1);
+        auto length = Base64::DecodeLength(textLength);
+        if (length == 0) {
+            return nullptr;
+        }
+        std::vector<char> buffer(length);
+        Base64::Decode(data, textLength, buffer.data());
+        return ImageCache::Shared()->decode(buffer.data(), length, options, progress);
+    }
+
+    static void loadImageFromURLMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        auto url = env->toStdString(args[0]);
+        auto options = toDecodeOptions(args[3], env);
+        LoadFunction load;
+        auto pos = url.substr(0, 5) == "data:" ? url.find(",") : std::string::npos;
+        if (pos != std::string::npos && pos != 5) {
+            load = [=](const Image::DecodeProgress& progress) {
+                return decodeDataURL(url, options, progress);
+            };
+        } else {
+            // Resolving the path reads the global state of the main thread, so it is done before posting the load.
+            auto path = Globals::resolvePath(url);
+            load = [=](const Image::DecodeProgress& progress) {
+                return ImageCache::Shared()->decodeFile(path, options, progress);
+            };
+        }
+        postLoad(args, load, env);
     }
 
     static void loadImageFromBytesMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
         auto env = Environment::GetCurrent(args);
         v8::HandleScope scope(env->isolate());
         auto arrayBuffer = v8::Local<v8::ArrayBuffer>::Cast(args[0]);
-        auto buffer = arrayBuffer->GetContents().Data();
-        auto length = arrayBuffer->ByteLength();
-        auto callback = v8::Local<v8::Function>::Cast(args[1]);
-        auto thisArg = v8::Local<v8::Object>::Cast(args[2]);
-        auto image = Image::Decode(buffer, length);
-        if (!image) {
-            env->call(callback, thisArg, env->makeNull());
-            return;
-        }
-        auto ImageClass = env->readGlobalFunction("Image");
-        auto imageObject = env->newInstance(ImageClass, env->makeExternal(image)).ToLocalChecked();
-        env->call(callback, thisArg, imageObject);
+        // The ArrayBuffer may be modified or garbage collected by the script while the load is running.
+        auto bytes = SkData::MakeWithCopy(arrayBuffer->GetContents().Data(), arrayBuffer->ByteLength());
+        auto options = toDecodeOptions(args[3], env);
+        postLoad(args, [=](const Image::DecodeProgress& progress) {
+            return ImageCache::Shared()->decode(bytes->data(), bytes->size(), options, progress);
+        }, env);
+    }
+
+    static void setImageDecodeConcurrencyMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        ImageDecodeQueue::Shared()->setMaxConcurrency(env->toInt(args[0]));
     }
 
+    static void setImageCacheLimitMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto bytes = env->toDouble(args[0]);
+        ImageCache::Shared()->setMaxBytes(bytes > 0 ? static_cast<size_t>(bytes) : 0);
+    }
+
+    static void getImageCacheStatsMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto imageCache = ImageCache::Shared();
+        auto stats = env->makeObject();
+        env->setObjectProperty(stats, "hits", static_cast<double>(imageCache->hitCount()));
+        env->setObjectProperty(stats, "misses", static_cast<double>(imageCache->missCount()));
+        env->setObjectProperty(stats, "imageCount", static_cast<double>(imageCache->imageCount()));
+        env->setObjectProperty(stats, "totalBytes", static_cast<double>(imageCache->totalBytes()));
+        env->setObjectProperty(stats, "maxBytes", static_cast<double>(imageCache->maxBytes()));
+        args.GetReturnValue().Set(stats);
+    }
+
+    static void setImageDiskCacheDirectoryMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto directory = args[0]->IsString() ? Globals::resolvePath(env->toStdString(args[0])) : "";
+        DiskImageCache::Shared()->setDirectory(directory);
+    }
+
+    static void setImageDiskCacheLimitMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto bytes = env->toDouble(args[0]);
+        DiskImageCache::Shared()->setMaxBytes(bytes > 0 ? static_cast<size_t>(bytes) : 0);
+    }
+
+    static void clearImageDiskCacheMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        DiskImageCache::Shared()->clear();
+    }
 
     void V8ImageLoader::install(const v8::Local<v8::Object>& parent, Environment* env) {
         auto cyderScope = env->readGlobalObject("cyder");
         env->setObjectProperty(cyderScope, "loadImageFromURL", loadImageFromURLMethod);
         env->setObjectProperty(cyderScope, "loadImageFromBytes", loadImageFromBytesMethod);
+        env->setObjectProperty(cyderScope, "setImageDecodeConcurrency", setImageDecodeConcurrencyMethod);
+        env->setObjectProperty(cyderScope, "setImageCacheLimit", setImageCacheLimitMethod);
+        env->setObjectProperty(cyderScope, "getImageCacheStats", getImageCacheStatsMethod);
+        env->setObjectProperty(cyderScope, "setImageDiskCacheDirectory", setImageDiskCacheDirectoryMethod);
+        env->setObjectProperty(cyderScope, "setImageDiskCacheLimit", setImageDiskCacheLimitMethod);
+        env->setObjectProperty(cyderScope, "clearImageDiskCache", clearImageDiskCacheMethod);
     }
 
 }
\ No newline at end of file
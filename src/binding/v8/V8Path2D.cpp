@@ -0,0 +1,99 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "V8Path2D.h"
+#include "V8PathMethods.h"
+#include "modules/canvas2d/Path2D.h"
+
+namespace cyder {
+
+    static v8::Persistent<v8::FunctionTemplate> path2DTemplate;
+
+    static Path2D* getPath(v8::Local<v8::Object> self) {
+        return static_cast<Path2D*>(self->GetAlignedPointerFromInternalField(0));
+    }
+
+    Path2D* V8Path2D::ToPath2D(v8::Local<v8::Value> value) {
+        if (!value->IsObject() || path2DTemplate.IsEmpty()) {
+            return nullptr;
+        }
+        auto isolate = v8::Isolate::GetCurrent();
+        auto classTemplate = v8::Local<v8::FunctionTemplate>::New(isolate, path2DTemplate);
+        if (!classTemplate->HasInstance(value)) {
+            return nullptr;
+        }
+        return getPath(v8::Local<v8::Object>::Cast(value));
+    }
+
+    static void addPathMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        auto path = V8Path2D::ToPath2D(args[0]);
+        if (!path) {
+            env->throwError(ErrorType::TYPE_ERROR,
+                            "Failed to execute 'addPath' on 'Path2D': parameter 1 is not of type 'Path2D'.");
+            return;
+        }
+        getPath(args.This())->addPath(*path);
+    }
+
+    static void constructor(const v8::FunctionCallbackInfo<v8::Value>& args) {
+        auto env = Environment::GetCurrent(args);
+        v8::HandleScope scope(env->isolate());
+        Path2D* path;
+        if (args[0]->IsUndefined()) {
+            path = new Path2D();
+        } else if (args[0]->IsString()) {
+            path = Path2D::FromSVGString(env->toStdString(args[0]));
+            if (!path) {
+                env->throwError(ErrorType::TYPE_ERROR,
+                                "Failed to construct 'Path2D': parameter 1 is invalid SVG path data.");
+                return;
+            }
+        } else {
+            auto source = V8Path2D::ToPath2D(args[0]);
+            if (!source) {
+                env->throwError(ErrorType::TYPE_ERROR,
+                                "Failed to construct 'Path2D': parameter 1 must be a Path2D or a string.");
+                return;
+            }
+            path = new Path2D(source->path());
+        }
+        auto self = args.This();
+        self->SetAlignedPointerInInternalField(0, path);
+        auto handle = env->bind(self, path);
+        self->SetAlignedPointerInInternalField(1, handle);
+    }
+
+    void V8Path2D::install(v8::Local<v8::Object> parent, Environment* env) {
+        auto classTemplate = env->makeFunctionTemplate(constructor);
+        auto prototypeTemplate = classTemplate->PrototypeTemplate();
+        env->setTemplateProperty(prototypeTemplate, "addPath", addPathMethod);
+        V8PathMethods<getPath>::install(prototypeTemplate, env);
+        path2DTemplate.Reset(env->isolate(), classTemplate);
+        env->attachClass(parent, "Path2D", classTemplate, 2);
+    }
+
+}
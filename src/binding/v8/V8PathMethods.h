@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_V8PATHMETHODS_H
+#define CYDER_V8PATHMETHODS_H
+
+#include <v8.h>
+#include "binding/Environment.h"
+#include "modules/canvas2d/Path2D.h"
+
+namespace cyder {
+
+    /**
+     * The path building methods shared by Path2D and CanvasRenderingContext2D. The GetPath parameter returns the
+     * native path that the methods should build on for a given receiver object.
+     */
+    template<Path2D* (* GetPath)(v8::Local<v8::Object>)>
+    class V8PathMethods {
+    public:
+        static void install(v8::Local<v8::ObjectTemplate> prototypeTemplate, Environment* env) {
+            env->setTemplateProperty(prototypeTemplate, "closePath", closePathMethod);
+            env->setTemplateProperty(prototypeTemplate, "moveTo", moveToMethod);
+            env->setTemplateProperty(prototypeTemplate, "lineTo", lineToMethod);
+            env->setTemplateProperty(prototypeTemplate, "quadraticCurveTo", quadraticCurveToMethod);
+            env->setTemplateProperty(prototypeTemplate, "bezierCurveTo", bezierCurveToMethod);
+            env->setTemplateProperty(prototypeTemplate, "arcTo", arcToMethod);
+            env->setTemplateProperty(prototypeTemplate, "arc", arcMethod);
+            env->setTemplateProperty(prototypeTemplate, "rect", rectMethod);
+        }
+
+    private:
+        static void closePathMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            GetPath(args.This())->closePath();
+        }
+
+        static void moveToMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            auto env = Environment::GetCurrent(args);
+            GetPath(args.This())->moveTo(env->toFloat(args[0]), env->toFloat(args[1]));
+        }
+
+        static void lineToMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            auto env = Environment::GetCurrent(args);
+            GetPath(args.This())->lineTo(env->toFloat(args[0]), env->toFloat(args[1]));
+        }
+
+        static void quadraticCurveToMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            auto env = Environment::GetCurrent(args);
+            GetPath(args.This())->quadraticCurveTo(env->toFloat(args[0]), env->toFloat(args[1]),
+                                                   env->toFloat(args[2]), env->toFloat(args[3]));
+        }
+
+        static void bezierCurveToMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            auto env = Environment::GetCurrent(args);
+            GetPath(args.This())->bezierCurveTo(env->toFloat(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                                env->toFloat(args[3]), env->toFloat(args[4]), env->toFloat(args[5]));
+        }
+
+        static void arcToMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            auto env = Environment::GetCurrent(args);
+            auto result = GetPath(args.This())->arcTo(env->toFloat(args[0]), env->toFloat(args[1]),
+                                                      env->toFloat(args[2]), env->toFloat(args[3]),
+                                                      env->toFloat(args[4]));
+            if (!result) {
+                env->throwError(ErrorType::RANGE_ERROR, "IndexSizeError: The radius provided is negative.");
+            }
+        }
+
+        static void arcMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            auto env = Environment::GetCurrent(args);
+            auto result = GetPath(args.This())->arc(env->toFloat(args[0]), env->toFloat(args[1]),
+                                                    env->toFloat(args[2]), env->toFloat(args[3]),
+                                                    env->toFloat(args[4]), env->toBoolean(args[5]));
+            if (!result) {
+                env->throwError(ErrorType::RANGE_ERROR, "IndexSizeError: The radius provided is negative.");
+            }
+        }
+
+        static void rectMethod(const v8::FunctionCallbackInfo<v8::Value>& args) {
+            auto env = Environment::GetCurrent(args);
+            GetPath(args.This())->rect(env->toFloat(args[0]), env->toFloat(args[1]), env->toFloat(args[2]),
+                                       env->toFloat(args[3]));
+        }
+    };
+
+}
+
+#endif //CYDER_V8PATHMETHODS_H
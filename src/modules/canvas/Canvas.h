@@ -74,6 +74,18 @@ namespace cyder {
             }
         }
 
+        /**
+         * Changes the width and the height at once, so that the buffer is reallocated at most once.
+         */
+        virtual void resize(int width, int height) {
+            if (buffer) {
+                buffer->resize(width, height);
+            } else {
+                _width = width;
+                _height = height;
+            }
+        }
+
     private:
         int _width;
         int _height;
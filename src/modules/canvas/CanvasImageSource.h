@@ -35,11 +35,37 @@ namespace cyder {
     public:
         virtual ~CanvasImageSource() {}
 
-        virtual void draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect) = 0;
+        /**
+         * Draws a part of this source into the destination rectangle.
+         * @param paint The paint holding the alpha, blend mode and filter quality to draw with, or nullptr to use the
+         * defaults.
+         */
+        virtual void draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect,
+                          const SkPaint* paint = nullptr) = 0;
+
+        /**
+         * Draws a batch of sprites of this source in one call.
+         * @param xforms The rotation, scale and translation of each sprite.
+         * @param texRects The source rectangle of each sprite, relative to this source.
+         * @param colors The colors to modulate with each sprite, or nullptr to draw the sprites unmodified.
+         * @param count The number of sprites to draw.
+         * @param paint The paint holding the alpha, blend mode and filter quality to draw with, or nullptr to use the
+         * defaults.
+         */
+        virtual void drawAtlas(SkCanvas* canvas, const SkRSXform xforms[], const SkRect texRects[],
+                               const SkColor colors[], int count, const SkPaint* paint = nullptr) = 0;
 
         virtual int width() const = 0;
 
         virtual int height() const = 0;
+
+        /**
+         * Returns true if this source only has an alpha channel. Skia fills such sources with the color of the paint,
+         * like a mask.
+         */
+        virtual bool isAlphaOnly() const {
+            return false;
+        }
     };
 
 }
@@ -51,6 +51,14 @@ namespace cyder {
 
         virtual void setHeight(int value) = 0;
 
+        /**
+         * Changes both the width and the height of the DrawingBuffer at once, which reallocates the pixels at most once.
+         */
+        virtual void resize(int width, int height) {
+            setWidth(width);
+            setHeight(height);
+        }
+
         /**
          * Return a canvas that will draw into this drawing buffer.
          * Note: Do not cache the return value of surface(), it may change when DrawingBuffer resizes.
@@ -67,6 +75,64 @@ namespace cyder {
          * will not be reflected in this image.
          */
         virtual Image* makeImageSnapshot() = 0;
+
+        /**
+         * Copies a rectangle of pixels from the buffer into the destination memory, converting them to the format of
+         * the destination info. Pixels outside of the buffer are left untouched. Returns false if the rectangle does
+         * not intersect the buffer or the pixels cannot be converted.
+         */
+        virtual bool readPixels(const SkImageInfo& dstInfo, void* dstPixels, size_t dstRowBytes, int x, int y) {
+            return getCanvas()->readPixels(dstInfo, dstPixels, dstRowBytes, x, y);
+        }
+
+        /**
+         * Copies a rectangle of pixels into the buffer at (x, y), ignoring the matrix, clip and blend mode of the
+         * canvas. Pixels outside of the buffer are skipped. The written area is added to the damage.
+         */
+        virtual bool writePixels(const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRowBytes, int x, int y) {
+            if (!getCanvas()->writePixels(srcInfo, srcPixels, srcRowBytes, x, y)) {
+                return false;
+            }
+            addDamage(SkRect::MakeXYWH(x, y, srcInfo.width(), srcInfo.height()));
+            return true;
+        }
+
+        /**
+         * Returns the bounds of the area that has changed since the content was last presented, in pixels.
+         */
+        const SkIRect& damageRect() const {
+            return _damageRect;
+        }
+
+        /**
+         * Adds a rectangle to the changed area of the buffer.
+         * @param rect The bounds of the changed pixels, in the coordinate space of the buffer.
+         */
+        void addDamage(const SkRect& rect) {
+            SkIRect bounds;
+            rect.roundOut(&bounds);
+            if (!bounds.intersect(SkIRect::MakeWH(width(), height()))) {
+                return;
+            }
+            _damageRect.join(bounds);
+        }
+
+        /**
+         * Marks the whole buffer as changed.
+         */
+        void damageAll() {
+            _damageRect = SkIRect::MakeWH(width(), height());
+        }
+
+        /**
+         * Clears the changed area, called once the content has been presented.
+         */
+        void resetDamage() {
+            _damageRect.setEmpty();
+        }
+
+    private:
+        SkIRect _damageRect = SkIRect::MakeEmpty();
     };
 
 }
@@ -25,31 +25,218 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "OffScreenBuffer.h"
-#include "platform/SurfaceFactory.h"
+#include <algorithm>
+#include "SurfacePool.h"
+#include "platform/AnimationFrame.h"
+#include "utils/ExternalMemory.h"
+#include "utils/ThreadPool.h"
 
 namespace cyder {
-    OffScreenBuffer::OffScreenBuffer(int width, int height, bool alpha, bool useGPU) :
-            _width(width), _height(height), alpha(alpha), useGPU(useGPU) {
+    // The size of the tiles rasterized in parallel, in pixels.
+    static const int TILE_SIZE = 256;
+
+    std::vector<OffScreenBuffer*>* OffScreenBuffer::tiledBuffers = nullptr;
+
+    void OffScreenBuffer::RasterizeAll() {
+        if (!tiledBuffers) {
+            return;
+        }
+        std::vector<OffScreenBuffer*> buffers;
+        buffers.swap(*tiledBuffers);
+        for (auto buffer : buffers) {
+            buffer->rasterize();
+        }
+    }
+
+    static void rasterizeAtFrameEnd(double timestamp) {
+        OffScreenBuffer::RasterizeAll();
+    }
+
+    /**
+     * The memory held by a surface taken from the pool, which may be larger than the buffer.
+     */
+    static int64_t SurfaceBytes(SkSurface* surface, SkColorType colorType) {
+        return static_cast<int64_t>(surface->width()) * surface->height() * SkColorTypeBytesPerPixel(colorType);
+    }
+
+    OffScreenBuffer::OffScreenBuffer(int width, int height, bool alpha, bool useGPU, bool tiled,
+                                     SkColorType colorType) :
+            _width(width), _height(height), alpha(alpha), useGPU(useGPU && colorType == kN32_SkColorType),
+            tiled(tiled), colorType(colorType) {
 
     }
 
     OffScreenBuffer::~OffScreenBuffer() {
-        SkSafeUnref(surface);
+        releaseSurface();
+        delete recorder;
+    }
+
+    // A surface that is kept on resize must not be more than this many times the area that is needed.
+    static const int MAX_WASTE_FACTOR = 4;
+
+    void OffScreenBuffer::resize(int width, int height) {
+        if (width < 0 || height < 0) {
+            return;
+        }
+        auto keepSurface = surface && surface->width() >= width && surface->height() >= height &&
+                           static_cast<int64_t>(surface->width()) * surface->height() <=
+                           static_cast<int64_t>(SurfacePool::BucketSize(width)) * SurfacePool::BucketSize(height) *
+                           MAX_WASTE_FACTOR;
+        if (keepSurface) {
+            discardRecording();
+            _width = width;
+            _height = height;
+            surface->getCanvas()->restoreToCount(1);
+            surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+            clipToSize();
+        } else {
+            releaseSurface();
+            _width = width;
+            _height = height;
+        }
+        damageAll();
+    }
+
+    void OffScreenBuffer::discardRecording() {
+        if (recorder && recorder->getRecordingCanvas()) {
+            auto buffers = tiledBuffers;
+            auto result = std::find(buffers->begin(), buffers->end(), this);
+            if (result != buffers->end()) {
+                buffers->erase(result);
+            }
+            recorder->finishRecordingAsPicture();
+        }
+    }
+
+    void OffScreenBuffer::releaseSurface() {
+        discardRecording();
+        if (surface) {
+            surface->getCanvas()->restoreToCount(1);
+            ExternalMemory::Adjust(-SurfaceBytes(surface, colorType));
+            SurfacePool::Shared()->release(surface, alpha, useGPU, colorType);
+            surface = nullptr;
+        }
+    }
+
+    void OffScreenBuffer::clipToSize() {
+        if (surface->width() == _width && surface->height() == _height) {
+            return;
+        }
+        auto canvas = surface->getCanvas();
+        canvas->save();
+        canvas->clipRect(SkRect::MakeIWH(_width, _height));
+    }
+
+    SkCanvas* OffScreenBuffer::getCanvas() {
+        auto surface = getSurface();
+        if (!tiled) {
+            return surface->getCanvas();
+        }
+        if (!recorder) {
+            recorder = new SkPictureRecorder();
+        }
+        auto canvas = recorder->getRecordingCanvas();
+        if (canvas) {
+            return canvas;
+        }
+        if (!tiledBuffers) {
+            tiledBuffers = new std::vector<OffScreenBuffer*>();
+        }
+        if (tiledBuffers->empty() && !AnimationFrame::InFrameUpdate()) {
+            // Like deferred contexts, only drawing outside of a frame callback needs a frame end to rasterize at.
+            AnimationFrame::Request(rasterizeAtFrameEnd);
+        }
+        tiledBuffers->push_back(this);
+        return recorder->beginRecording(SkRect::MakeIWH(_width, _height));
+    }
+
+    void OffScreenBuffer::rasterize() {
+        if (!recorder || !recorder->getRecordingCanvas()) {
+            return;
+        }
+        auto buffers = tiledBuffers;
+        auto result = std::find(buffers->begin(), buffers->end(), this);
+        if (result != buffers->end()) {
+            buffers->erase(result);
+        }
+        auto picture = recorder->finishRecordingAsPicture();
+        // Detach the pixels from any snapshot before writing to them behind the surface.
+        surface->notifyContentWillChange(SkSurface::kRetain_ContentChangeMode);
+        SkPixmap pixmap;
+        if (!surface->peekPixels(&pixmap)) {
+            surface->getCanvas()->drawPicture(picture);
+            return;
+        }
+        int columns = (_width + TILE_SIZE - 1) / TILE_SIZE;
+        int rows = (_height + TILE_SIZE - 1) / TILE_SIZE;
+        ThreadPool::Shared()->parallelFor(columns * rows, [&](int index) {
+            int x = (index % columns) * TILE_SIZE;
+            int y = (index / columns) * TILE_SIZE;
+            auto info = pixmap.info().makeWH(std::min(TILE_SIZE, _width - x), std::min(TILE_SIZE, _height - y));
+            auto canvas = SkCanvas::MakeRasterDirect(info, pixmap.writable_addr(x, y), pixmap.rowBytes());
+            canvas->translate(-x, -y);
+            canvas->drawPicture(picture);
+        });
+    }
+
+    void OffScreenBuffer::draw(SkCanvas* canvas, SkScalar x, SkScalar y, const SkPaint* paint) {
+        rasterize();
+        auto surface = getSurface();
+        if (surface->width() == _width && surface->height() == _height) {
+            surface->draw(canvas, x, y, paint);
+            return;
+        }
+        canvas->save();
+        canvas->clipRect(SkRect::MakeXYWH(x, y, _width, _height));
+        surface->draw(canvas, x, y, paint);
+        canvas->restore();
     }
 
     Image* OffScreenBuffer::makeImageSnapshot() {
-        auto image = getSurface()->makeImageSnapshot().release();
-        return new Image(image);
+        rasterize();
+        // The snapshot is how the content of an off-screen buffer gets presented.
+        resetDamage();
+        auto surface = getSurface();
+        auto image = surface->makeImageSnapshot().release();
+        if (surface->width() == _width && surface->height() == _height) {
+            return new Image(image);
+        }
+        // The pooled surface may be larger than the buffer, share its pixels through a subset.
+        return new Image(image, SkIRect::MakeWH(_width, _height));
+    }
+
+    bool OffScreenBuffer::readPixels(const SkImageInfo& dstInfo, void* dstPixels, size_t dstRowBytes, int x, int y) {
+        rasterize();
+        // Reading straight from the surface canvas copies the pixels once, without making a snapshot first.
+        return getSurface()->getCanvas()->readPixels(dstInfo, dstPixels, dstRowBytes, x, y);
+    }
+
+    bool OffScreenBuffer::writePixels(const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRowBytes, int x,
+                                      int y) {
+        // Keep the order of the commands recorded before this call.
+        rasterize();
+        if (!getSurface()->getCanvas()->writePixels(srcInfo, srcPixels, srcRowBytes, x, y)) {
+            return false;
+        }
+        addDamage(SkRect::MakeXYWH(x, y, srcInfo.width(), srcInfo.height()));
+        return true;
     }
 
     SkSurface* OffScreenBuffer::getSurface() {
         if (surface) {
             return surface;
         }
-        if (useGPU) {
-            surface = SurfaceFactory::MakeGPU(_width, _height, alpha);
-        } else {
-            surface = SurfaceFactory::MakeRaster(_width, _height, alpha);
+        surface = SurfacePool::Shared()->acquire(_width, _height, alpha, useGPU, colorType);
+        if (!surface) {
+            return nullptr;
+        }
+        ExternalMemory::Adjust(SurfaceBytes(surface, colorType));
+        clipToSize();
+        if (tiled) {
+            // Only raster surfaces can be split into tiles, which may also be the case for GPU surfaces on hosts
+            // without a GPU backend.
+            SkPixmap pixmap;
+            tiled = surface->peekPixels(&pixmap);
         }
         return surface;
     }
@@ -27,6 +27,7 @@
 #ifndef CYDER_OFFSCREENBUFFER_H
 #define CYDER_OFFSCREENBUFFER_H
 
+#include <vector>
 #include "modules/canvas/DrawingBuffer.h"
 #include <skia.h>
 
@@ -34,7 +35,22 @@ namespace cyder {
 
     class OffScreenBuffer : public DrawingBuffer {
     public:
-        OffScreenBuffer(int width, int height, bool alpha = true, bool useGPU = true);
+        /**
+         * Rasterizes the pending commands of all tiled buffers. It is called once at the end of each frame.
+         */
+        static void RasterizeAll();
+
+        /**
+         * Creates an off-screen buffer.
+         * @param tiled If true and the buffer is backed by a raster surface, the drawing commands are recorded and then
+         * rasterized in tiles on the shared thread pool before the pixels are used. Texture-backed images must not be
+         * drawn into a tiled buffer, since they cannot be read on worker threads.
+         * @param colorType The color type of the pixels, which is either the native 32-bit type,
+         * kRGB_565_SkColorType or kAlpha_8_SkColorType. Buffers of the last two types are always backed by a raster
+         * surface.
+         */
+        OffScreenBuffer(int width, int height, bool alpha = true, bool useGPU = true, bool tiled = false,
+                        SkColorType colorType = kN32_SkColorType);
 
         ~OffScreenBuffer() override;
 
@@ -43,11 +59,7 @@ namespace cyder {
         }
 
         void setWidth(int value) override {
-            if (value < 0) {
-                return;
-            }
-            invalidateSize();
-            _width = value;
+            resize(value, _height);
         }
 
         int height() const override {
@@ -55,39 +67,60 @@ namespace cyder {
         }
 
         void setHeight(int value) override {
-            if (value < 0) {
-                return;
-            }
-            invalidateSize();
-            _height = value;
+            resize(_width, value);
         }
 
-        SkCanvas* getCanvas() override {
-            return getSurface()->getCanvas();
-        }
+        /**
+         * Changes the size of the buffer and clears its content, also when the size does not change. The current
+         * surface is kept if the new size still fits in it and does not waste most of it, otherwise it is given back to
+         * the surface pool.
+         */
+        void resize(int width, int height) override;
 
-        void draw(SkCanvas* canvas, SkScalar x, SkScalar y, const SkPaint* paint) override {
-            getSurface()->draw(canvas, x, y, paint);
-        }
+        SkCanvas* getCanvas() override;
+
+        void draw(SkCanvas* canvas, SkScalar x, SkScalar y, const SkPaint* paint) override;
 
         Image* makeImageSnapshot() override;
 
+        bool readPixels(const SkImageInfo& dstInfo, void* dstPixels, size_t dstRowBytes, int x, int y) override;
+
+        bool writePixels(const SkImageInfo& srcInfo, const void* srcPixels, size_t srcRowBytes, int x, int y) override;
+
+        /**
+         * Rasterizes the recorded commands of a tiled buffer into its surface, and waits for all the tiles to finish.
+         */
+        void rasterize();
+
     private:
         int _width;
         int _height;
         bool useGPU;
         bool alpha;
         bool contentChanged = false;
+        bool tiled;
+        SkColorType colorType;
         SkSurface* surface = nullptr;
+        SkPictureRecorder* recorder = nullptr;
+
+        static std::vector<OffScreenBuffer*>* tiledBuffers;
 
         SkSurface* getSurface();
 
-        void invalidateSize() {
-            if (surface) {
-                SkSafeUnref(surface);
-                surface = nullptr;
-            }
-        }
+        /**
+         * Drops the commands recorded since the last rasterization.
+         */
+        void discardRecording();
+
+        /**
+         * Drops any recording and gives the surface back to the surface pool.
+         */
+        void releaseSurface();
+
+        /**
+         * Limits the drawing on the surface canvas to the size of the buffer, which may be smaller than the surface.
+         */
+        void clipToSize();
     };
 
 }
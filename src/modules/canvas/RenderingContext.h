@@ -35,6 +35,12 @@ namespace cyder {
     public:
         virtual ~RenderingContext() {
         }
+
+        /**
+         * Applies all pending drawing commands to the drawing buffer.
+         */
+        virtual void flush() {
+        }
     };
 
 }
@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "SurfacePool.h"
+#include "platform/SurfaceFactory.h"
+
+namespace cyder {
+    // Sizes are rounded up to a multiple of the bucket size, so that slightly different sizes share surfaces.
+    static const int BUCKET_SIZE = 64;
+    static const size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+
+    SurfacePool* SurfacePool::Shared() {
+        static SurfacePool* pool = new SurfacePool(DEFAULT_MAX_BYTES);
+        return pool;
+    }
+
+    int SurfacePool::BucketSize(int size) {
+        if (size <= 0) {
+            return BUCKET_SIZE;
+        }
+        return (size + BUCKET_SIZE - 1) / BUCKET_SIZE * BUCKET_SIZE;
+    }
+
+    SurfacePool::SurfacePool(size_t maxBytes) : _maxBytes(maxBytes) {
+    }
+
+    SurfacePool::~SurfacePool() {
+        clear();
+    }
+
+    void SurfacePool::setMaxBytes(size_t value) {
+        _maxBytes = value;
+        trimTo(_maxBytes);
+    }
+
+    SkSurface* SurfacePool::acquire(int width, int height, bool transparent, bool useGPU, SkColorType colorType) {
+        auto bucketWidth = BucketSize(width);
+        auto bucketHeight = BucketSize(height);
+        for (auto it = entries.begin(); it != entries.end(); ++it) {
+            if (it->width == bucketWidth && it->height == bucketHeight && it->transparent == transparent &&
+                it->useGPU == useGPU && it->colorType == colorType) {
+                auto surface = it->surface;
+                totalBytes -= it->byteSize;
+                entries.erase(it);
+                surface->getCanvas()->clear(SK_ColorTRANSPARENT);
+                return surface;
+            }
+        }
+        SkSurface* surface;
+        if (useGPU) {
+            surface = SurfaceFactory::MakeGPU(bucketWidth, bucketHeight, transparent);
+        } else {
+            surface = SurfaceFactory::MakeRaster(bucketWidth, bucketHeight, transparent, colorType);
+        }
+        return surface;
+    }
+
+    void SurfacePool::release(SkSurface* surface, bool transparent, bool useGPU, SkColorType colorType) {
+        if (!surface) {
+            return;
+        }
+        size_t byteSize = static_cast<size_t>(surface->width()) * surface->height() *
+                          SkColorTypeBytesPerPixel(colorType);
+        if (byteSize > _maxBytes || BucketSize(surface->width()) != surface->width() ||
+            BucketSize(surface->height()) != surface->height()) {
+            SkSafeUnref(surface);
+            return;
+        }
+        trimTo(_maxBytes - byteSize);
+        Entry entry = {surface, surface->width(), surface->height(), transparent, useGPU, colorType, byteSize};
+        entries.push_front(entry);
+        totalBytes += byteSize;
+    }
+
+    void SurfacePool::clear() {
+        trimTo(0);
+    }
+
+    void SurfacePool::trimTo(size_t maxBytes) {
+        while (totalBytes > maxBytes && !entries.empty()) {
+            auto& entry = entries.back();
+            totalBytes -= entry.byteSize;
+            SkSafeUnref(entry.surface);
+            entries.pop_back();
+        }
+    }
+}
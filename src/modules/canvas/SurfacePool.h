@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_SURFACEPOOL_H
+#define CYDER_SURFACEPOOL_H
+
+#include <list>
+#include <skia.h>
+
+namespace cyder {
+
+    /**
+     * A cache of released surfaces, so that off-screen buffers which are created and collected every frame do not
+     * allocate a new surface each time. Sizes are rounded up to buckets, a pooled surface is usually larger than the
+     * requested size and the caller is expected to draw into the top-left part only.
+     */
+    class SurfacePool {
+    public:
+        /**
+         * Returns the pool shared by all off-screen buffers.
+         */
+        static SurfacePool* Shared();
+
+        /**
+         * Rounds a requested size up to the size of its bucket.
+         */
+        static int BucketSize(int size);
+
+        /**
+         * Creates a pool holding at most maxBytes of released surfaces.
+         */
+        explicit SurfacePool(size_t maxBytes);
+
+        ~SurfacePool();
+
+        size_t maxBytes() const {
+            return _maxBytes;
+        }
+
+        /**
+         * Changes the memory cap of the pool, releasing the least recently pooled surfaces that exceed it.
+         */
+        void setMaxBytes(size_t value);
+
+        /**
+         * Returns a surface of at least the given size with all pixels cleared, either from the pool or newly created
+         * by SurfaceFactory. The caller owns the returned surface and should give it back with release(). Returns
+         * nullptr if the surface cannot be created. GPU surfaces always have the native 32-bit color type.
+         */
+        SkSurface* acquire(int width, int height, bool transparent, bool useGPU,
+                           SkColorType colorType = kN32_SkColorType);
+
+        /**
+         * Gives a surface returned by acquire() back to the pool, with the same arguments it was acquired with.
+         */
+        void release(SkSurface* surface, bool transparent, bool useGPU, SkColorType colorType = kN32_SkColorType);
+
+        /**
+         * Releases all the pooled surfaces.
+         */
+        void clear();
+
+    private:
+        struct Entry {
+            SkSurface* surface;
+            int width;
+            int height;
+            bool transparent;
+            bool useGPU;
+            SkColorType colorType;
+            size_t byteSize;
+        };
+
+        size_t _maxBytes;
+        size_t totalBytes = 0;
+        // The most recently released surfaces are at the front.
+        std::list<Entry> entries;
+
+        void trimTo(size_t maxBytes);
+    };
+
+}
+
+#endif //CYDER_SURFACEPOOL_H
@@ -0,0 +1,383 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "CSSColor.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <vector>
+#include "utils/StringUtil.h"
+
+namespace cyder {
+
+    struct NamedColor {
+        const char* name;
+        SkColor color;
+    };
+
+    // Sorted by name for binary search.
+    static const NamedColor NAMED_COLORS[] = {
+            {"aliceblue", 0xFFF0F8FF},
+            {"antiquewhite", 0xFFFAEBD7},
+            {"aqua", 0xFF00FFFF},
+            {"aquamarine", 0xFF7FFFD4},
+            {"azure", 0xFFF0FFFF},
+            {"beige", 0xFFF5F5DC},
+            {"bisque", 0xFFFFE4C4},
+            {"black", 0xFF000000},
+            {"blanchedalmond", 0xFFFFEBCD},
+            {"blue", 0xFF0000FF},
+            {"blueviolet", 0xFF8A2BE2},
+            {"brown", 0xFFA52A2A},
+            {"burlywood", 0xFFDEB887},
+            {"cadetblue", 0xFF5F9EA0},
+            {"chartreuse", 0xFF7FFF00},
+            {"chocolate", 0xFFD2691E},
+            {"coral", 0xFFFF7F50},
+            {"cornflowerblue", 0xFF6495ED},
+            {"cornsilk", 0xFFFFF8DC},
+            {"crimson", 0xFFDC143C},
+            {"cyan", 0xFF00FFFF},
+            {"darkblue", 0xFF00008B},
+            {"darkcyan", 0xFF008B8B},
+            {"darkgoldenrod", 0xFFB8860B},
+            {"darkgray", 0xFFA9A9A9},
+            {"darkgreen", 0xFF006400},
+            {"darkgrey", 0xFFA9A9A9},
+            {"darkkhaki", 0xFFBDB76B},
+            {"darkmagenta", 0xFF8B008B},
+            {"darkolivegreen", 0xFF556B2F},
+            {"darkorange", 0xFFFF8C00},
+            {"darkorchid", 0xFF9932CC},
+            {"darkred", 0xFF8B0000},
+            {"darksalmon", 0xFFE9967A},
+            {"darkseagreen", 0xFF8FBC8F},
+            {"darkslateblue", 0xFF483D8B},
+            {"darkslategray", 0xFF2F4F4F},
+            {"darkslategrey", 0xFF2F4F4F},
+            {"darkturquoise", 0xFF00CED1},
+            {"darkviolet", 0xFF9400D3},
+            {"deeppink", 0xFFFF1493},
+            {"deepskyblue", 0xFF00BFFF},
+            {"dimgray", 0xFF696969},
+            {"dimgrey", 0xFF696969},
+            {"dodgerblue", 0xFF1E90FF},
+            {"firebrick", 0xFFB22222},
+            {"floralwhite", 0xFFFFFAF0},
+            {"forestgreen", 0xFF228B22},
+            {"fuchsia", 0xFFFF00FF},
+            {"gainsboro", 0xFFDCDCDC},
+            {"ghostwhite", 0xFFF8F8FF},
+            {"gold", 0xFFFFD700},
+            {"goldenrod", 0xFFDAA520},
+            {"gray", 0xFF808080},
+            {"green", 0xFF008000},
+            {"greenyellow", 0xFFADFF2F},
+            {"grey", 0xFF808080},
+            {"honeydew", 0xFFF0FFF0},
+            {"hotpink", 0xFFFF69B4},
+            {"indianred", 0xFFCD5C5C},
+            {"indigo", 0xFF4B0082},
+            {"ivory", 0xFFFFFFF0},
+            {"khaki", 0xFFF0E68C},
+            {"lavender", 0xFFE6E6FA},
+            {"lavenderblush", 0xFFFFF0F5},
+            {"lawngreen", 0xFF7CFC00},
+            {"lemonchiffon", 0xFFFFFACD},
+            {"lightblue", 0xFFADD8E6},
+            {"lightcoral", 0xFFF08080},
+            {"lightcyan", 0xFFE0FFFF},
+            {"lightgoldenrodyellow", 0xFFFAFAD2},
+            {"lightgray", 0xFFD3D3D3},
+            {"lightgreen", 0xFF90EE90},
+            {"lightgrey", 0xFFD3D3D3},
+            {"lightpink", 0xFFFFB6C1},
+            {"lightsalmon", 0xFFFFA07A},
+            {"lightseagreen", 0xFF20B2AA},
+            {"lightskyblue", 0xFF87CEFA},
+            {"lightslategray", 0xFF778899},
+            {"lightslategrey", 0xFF778899},
+            {"lightsteelblue", 0xFFB0C4DE},
+            {"lightyellow", 0xFFFFFFE0},
+            {"lime", 0xFF00FF00},
+            {"limegreen", 0xFF32CD32},
+            {"linen", 0xFFFAF0E6},
+            {"magenta", 0xFFFF00FF},
+            {"maroon", 0xFF800000},
+            {"mediumaquamarine", 0xFF66CDAA},
+            {"mediumblue", 0xFF0000CD},
+            {"mediumorchid", 0xFFBA55D3},
+            {"mediumpurple", 0xFF9370DB},
+            {"mediumseagreen", 0xFF3CB371},
+            {"mediumslateblue", 0xFF7B68EE},
+            {"mediumspringgreen", 0xFF00FA9A},
+            {"mediumturquoise", 0xFF48D1CC},
+            {"mediumvioletred", 0xFFC71585},
+            {"midnightblue", 0xFF191970},
+            {"mintcream", 0xFFF5FFFA},
+            {"mistyrose", 0xFFFFE4E1},
+            {"moccasin", 0xFFFFE4B5},
+            {"navajowhite", 0xFFFFDEAD},
+            {"navy", 0xFF000080},
+            {"oldlace", 0xFFFDF5E6},
+            {"olive", 0xFF808000},
+            {"olivedrab", 0xFF6B8E23},
+            {"orange", 0xFFFFA500},
+            {"orangered", 0xFFFF4500},
+            {"orchid", 0xFFDA70D6},
+            {"palegoldenrod", 0xFFEEE8AA},
+            {"palegreen", 0xFF98FB98},
+            {"paleturquoise", 0xFFAFEEEE},
+            {"palevioletred", 0xFFDB7093},
+            {"papayawhip", 0xFFFFEFD5},
+            {"peachpuff", 0xFFFFDAB9},
+            {"peru", 0xFFCD853F},
+            {"pink", 0xFFFFC0CB},
+            {"plum", 0xFFDDA0DD},
+            {"powderblue", 0xFFB0E0E6},
+            {"purple", 0xFF800080},
+            {"rebeccapurple", 0xFF663399},
+            {"red", 0xFFFF0000},
+            {"rosybrown", 0xFFBC8F8F},
+            {"royalblue", 0xFF4169E1},
+            {"saddlebrown", 0xFF8B4513},
+            {"salmon", 0xFFFA8072},
+            {"sandybrown", 0xFFF4A460},
+            {"seagreen", 0xFF2E8B57},
+            {"seashell", 0xFFFFF5EE},
+            {"sienna", 0xFFA0522D},
+            {"silver", 0xFFC0C0C0},
+            {"skyblue", 0xFF87CEEB},
+            {"slateblue", 0xFF6A5ACD},
+            {"slategray", 0xFF708090},
+            {"slategrey", 0xFF708090},
+            {"snow", 0xFFFFFAFA},
+            {"springgreen", 0xFF00FF7F},
+            {"steelblue", 0xFF4682B4},
+            {"tan", 0xFFD2B48C},
+            {"teal", 0xFF008080},
+            {"thistle", 0xFFD8BFD8},
+            {"tomato", 0xFFFF6347},
+            {"turquoise", 0xFF40E0D0},
+            {"violet", 0xFFEE82EE},
+            {"wheat", 0xFFF5DEB3},
+            {"white", 0xFFFFFFFF},
+            {"whitesmoke", 0xFFF5F5F5},
+            {"yellow", 0xFFFFFF00},
+            {"yellowgreen", 0xFF9ACD32},
+    };
+
+    static bool parseNamedColor(const std::string& name, SkColor* result) {
+        auto begin = std::begin(NAMED_COLORS);
+        auto end = std::end(NAMED_COLORS);
+        auto item = std::lower_bound(begin, end, name, [](const NamedColor& color, const std::string& value) {
+            return strcmp(color.name, value.c_str()) < 0;
+        });
+        if (item == end || name != item->name) {
+            return false;
+        }
+        *result = item->color;
+        return true;
+    }
+
+    static int hexValue(char c) {
+        if (c >= '0' && c <= '9') {
+            return c - '0';
+        }
+        if (c >= 'a' && c <= 'f') {
+            return c - 'a' + 10;
+        }
+        return -1;
+    }
+
+    static bool parseHexColor(const std::string& text, SkColor* result) {
+        auto length = text.size() - 1;
+        if (length != 3 && length != 4 && length != 6 && length != 8) {
+            return false;
+        }
+        int digits[8];
+        for (size_t i = 0; i < length; i++) {
+            digits[i] = hexValue(text[i + 1]);
+            if (digits[i] < 0) {
+                return false;
+            }
+        }
+        unsigned channels[4] = {0, 0, 0, 255};
+        if (length <= 4) {
+            for (size_t i = 0; i < length; i++) {
+                channels[i] = static_cast<unsigned>(digits[i] * 17);
+            }
+        } else {
+            for (size_t i = 0; i < length / 2; i++) {
+                channels[i] = static_cast<unsigned>(digits[i * 2] * 16 + digits[i * 2 + 1]);
+            }
+        }
+        *result = SkColorSetARGB(channels[3], channels[0], channels[1], channels[2]);
+        return true;
+    }
+
+    static unsigned clampChannel(double value) {
+        return static_cast<unsigned>(std::round(std::min(std::max(value, 0.0), 255.0)));
+    }
+
+    // Parses the comma separated arguments of a functional notation, percentages are returned as fractions.
+    static bool parseArguments(const std::string& text, std::vector<double>* values, std::vector<bool>* percentages) {
+        auto start = text.find('(');
+        if (start == std::string::npos || text.back() != ')') {
+            return false;
+        }
+        auto items = StringUtil::Split(text.substr(start + 1, text.size() - start - 2), ",");
+        for (auto& item : items) {
+            const char* begin = item.c_str();
+            char* end = nullptr;
+            double value = strtod(begin, &end);
+            if (end == begin || !std::isfinite(value)) {
+                return false;
+            }
+            while (*end == ' ') {
+                end++;
+            }
+            bool percentage = (*end == '%');
+            if (percentage) {
+                end++;
+                while (*end == ' ') {
+                    end++;
+                }
+            }
+            if (*end != '\0') {
+                return false;
+            }
+            values->push_back(percentage ? value / 100 : value);
+            percentages->push_back(percentage);
+        }
+        return true;
+    }
+
+    static double hueToRGB(double m1, double m2, double hue) {
+        if (hue < 0) {
+            hue += 1;
+        } else if (hue > 1) {
+            hue -= 1;
+        }
+        if (hue * 6 < 1) {
+            return m1 + (m2 - m1) * hue * 6;
+        }
+        if (hue * 2 < 1) {
+            return m2;
+        }
+        if (hue * 3 < 2) {
+            return m1 + (m2 - m1) * (2.0 / 3 - hue) * 6;
+        }
+        return m1;
+    }
+
+    static bool parseFunctionalColor(const std::string& text, SkColor* result) {
+        bool isRGB = text.compare(0, 3, "rgb") == 0;
+        bool isHSL = text.compare(0, 3, "hsl") == 0;
+        if (!isRGB && !isHSL) {
+            return false;
+        }
+        std::vector<double> values;
+        std::vector<bool> percentages;
+        if (!parseArguments(text, &values, &percentages) || (values.size() != 3 && values.size() != 4)) {
+            return false;
+        }
+        double alpha = values.size() == 4 ? std::min(std::max(values[3], 0.0), 1.0) : 1.0;
+        unsigned channels[3];
+        if (isRGB) {
+            for (int i = 0; i < 3; i++) {
+                channels[i] = clampChannel(percentages[i] ? values[i] * 255 : values[i]);
+            }
+        } else {
+            if (percentages[0] || !percentages[1] || !percentages[2]) {
+                return false;
+            }
+            double hue = std::fmod(values[0], 360.0) / 360;
+            if (hue < 0) {
+                hue += 1;
+            }
+            double saturation = std::min(std::max(values[1], 0.0), 1.0);
+            double lightness = std::min(std::max(values[2], 0.0), 1.0);
+            double m2 = lightness <= 0.5 ? lightness * (saturation + 1) : lightness + saturation - lightness * saturation;
+            double m1 = lightness * 2 - m2;
+            channels[0] = clampChannel(hueToRGB(m1, m2, hue + 1.0 / 3) * 255);
+            channels[1] = clampChannel(hueToRGB(m1, m2, hue) * 255);
+            channels[2] = clampChannel(hueToRGB(m1, m2, hue - 1.0 / 3) * 255);
+        }
+        *result = SkColorSetARGB(clampChannel(alpha * 255), channels[0], channels[1], channels[2]);
+        return true;
+    }
+
+    bool CSSColor::Parse(const std::string& text, SkColor* result) {
+        auto start = text.find_first_not_of(" \t\n\r\f");
+        if (start == std::string::npos) {
+            return false;
+        }
+        auto end = text.find_last_not_of(" \t\n\r\f");
+        auto value = StringUtil::ToLowerCase(text.substr(start, end - start + 1));
+        if (value[0] == '#') {
+            return parseHexColor(value, result);
+        }
+        if (value == "transparent") {
+            *result = SK_ColorTRANSPARENT;
+            return true;
+        }
+        if (value.find('(') != std::string::npos) {
+            return parseFunctionalColor(value, result);
+        }
+        return parseNamedColor(value, result);
+    }
+
+    std::string CSSColor::Serialize(SkColor color) {
+        char buffer[32];
+        auto alpha = SkColorGetA(color);
+        if (alpha == 255) {
+            snprintf(buffer, sizeof(buffer), "#%02x%02x%02x", SkColorGetR(color), SkColorGetG(color),
+                     SkColorGetB(color));
+            return std::string(buffer);
+        }
+        // Use the shortest alpha text that maps back to the same alpha value.
+        std::string alphaText;
+        for (int precision = 1; precision <= 3; precision++) {
+            snprintf(buffer, sizeof(buffer), "%.*f", precision, alpha / 255.0);
+            alphaText = buffer;
+            if (clampChannel(atof(buffer) * 255) == alpha) {
+                break;
+            }
+        }
+        alphaText.erase(alphaText.find_last_not_of('0') + 1);
+        if (alphaText.back() == '.') {
+            alphaText.pop_back();
+        }
+        snprintf(buffer, sizeof(buffer), "rgba(%u, %u, %u, %s)", SkColorGetR(color), SkColorGetG(color),
+                 SkColorGetB(color), alphaText.c_str());
+        return std::string(buffer);
+    }
+
+}
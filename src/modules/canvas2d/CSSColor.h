@@ -0,0 +1,56 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_CSSCOLOR_H
+#define CYDER_CSSCOLOR_H
+
+#include <string>
+#include <skia.h>
+
+namespace cyder {
+
+    /**
+     * Converts colors between CSS color strings and SkColor values.
+     */
+    class CSSColor {
+    public:
+        /**
+         * Parses a CSS color string. Supports the #rgb, #rgba, #rrggbb, #rrggbbaa, rgb(), rgba(), hsl(), hsla() notations,
+         * the named colors and "transparent".
+         * @returns false if the string is not a valid color, in which case the result is not modified.
+         */
+        static bool Parse(const std::string& text, SkColor* result);
+
+        /**
+         * Returns the serialization of a color as specified for the canvas: "#rrggbb" for opaque colors, or
+         * "rgba(r, g, b, a)" otherwise.
+         */
+        static std::string Serialize(SkColor color);
+    };
+
+}
+
+#endif //CYDER_CSSCOLOR_H
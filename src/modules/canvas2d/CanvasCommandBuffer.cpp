@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "CanvasCommandBuffer.h"
+
+namespace cyder {
+
+    // The number of operand words following each opcode, indexed by opcode.
+    static const size_t OPERAND_COUNTS[] = {
+            0, 0, 6, 6, 2, 1, 2, 1, 1, 1, 1, 0, 0, 2, 2, 4, 6, 6, 4, 1, 0, 4, 4, 4, 9
+    };
+
+    static const size_t COMMAND_COUNT = sizeof(OPERAND_COUNTS) / sizeof(OPERAND_COUNTS[0]);
+
+    bool CanvasCommandBuffer::Execute(CanvasRenderingContext2D* context, const void* data, size_t length,
+                                      const std::vector<CanvasImageSource*>& images) {
+        // The scripts write the same memory through an Uint32Array and a Float32Array.
+        auto words = static_cast<const uint32_t*>(data);
+        auto floats = static_cast<const float*>(data);
+        size_t position = 0;
+        while (position < length) {
+            auto opcode = words[position];
+            if (opcode >= COMMAND_COUNT || position + 1 + OPERAND_COUNTS[opcode] > length) {
+                return false;
+            }
+            const float* f = floats + position + 1;
+            const uint32_t* w = words + position + 1;
+            position += 1 + OPERAND_COUNTS[opcode];
+            switch (static_cast<CanvasCommand>(opcode)) {
+                case CanvasCommand::SAVE:
+                    context->save();
+                    break;
+                case CanvasCommand::RESTORE:
+                    context->restore();
+                    break;
+                case CanvasCommand::SET_TRANSFORM:
+                    context->setTransform(f[0], f[1], f[2], f[3], f[4], f[5]);
+                    break;
+                case CanvasCommand::TRANSFORM:
+                    context->transform(f[0], f[1], f[2], f[3], f[4], f[5]);
+                    break;
+                case CanvasCommand::TRANSLATE:
+                    context->translate(f[0], f[1]);
+                    break;
+                case CanvasCommand::ROTATE:
+                    context->rotate(f[0]);
+                    break;
+                case CanvasCommand::SCALE:
+                    context->scale(f[0], f[1]);
+                    break;
+                case CanvasCommand::GLOBAL_ALPHA:
+                    context->setGlobalAlpha(f[0]);
+                    break;
+                case CanvasCommand::FILL_STYLE:
+                    context->setFillStyle(w[0]);
+                    break;
+                case CanvasCommand::STROKE_STYLE:
+                    context->setStrokeStyle(w[0]);
+                    break;
+                case CanvasCommand::LINE_WIDTH:
+                    context->setLineWidth(f[0]);
+                    break;
+                case CanvasCommand::BEGIN_PATH:
+                    context->beginPath();
+                    break;
+                case CanvasCommand::CLOSE_PATH:
+                    context->currentPath()->closePath();
+                    break;
+                case CanvasCommand::MOVE_TO:
+                    context->currentPath()->moveTo(f[0], f[1]);
+                    break;
+                case CanvasCommand::LINE_TO:
+                    context->currentPath()->lineTo(f[0], f[1]);
+                    break;
+                case CanvasCommand::QUADRATIC_CURVE_TO:
+                    context->currentPath()->quadraticCurveTo(f[0], f[1], f[2], f[3]);
+                    break;
+                case CanvasCommand::BEZIER_CURVE_TO:
+                    context->currentPath()->bezierCurveTo(f[0], f[1], f[2], f[3], f[4], f[5]);
+                    break;
+                case CanvasCommand::ARC:
+                    // The encoder throws for a negative radius, the path ignores it here.
+                    context->currentPath()->arc(f[0], f[1], f[2], f[3], f[4], w[5] != 0);
+                    break;
+                case CanvasCommand::RECT:
+                    context->currentPath()->rect(f[0], f[1], f[2], f[3]);
+                    break;
+                case CanvasCommand::FILL:
+                    context->fill(nullptr, w[0] ? SkPath::kEvenOdd_FillType : SkPath::kWinding_FillType);
+                    break;
+                case CanvasCommand::STROKE:
+                    context->stroke(nullptr);
+                    break;
+                case CanvasCommand::FILL_RECT:
+                    context->fillRect(f[0], f[1], f[2], f[3]);
+                    break;
+                case CanvasCommand::STROKE_RECT:
+                    context->strokeRect(f[0], f[1], f[2], f[3]);
+                    break;
+                case CanvasCommand::CLEAR_RECT:
+                    context->clearRect(f[0], f[1], f[2], f[3]);
+                    break;
+                case CanvasCommand::DRAW_IMAGE:
+                    if (w[0] < images.size() && images[w[0]]) {
+                        context->drawImage(images[w[0]], f[1], f[2], f[3], f[4], f[5], f[6], f[7], f[8]);
+                    }
+                    break;
+            }
+        }
+        return true;
+    }
+}
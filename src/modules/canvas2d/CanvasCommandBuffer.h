@@ -0,0 +1,89 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_CANVASCOMMANDBUFFER_H
+#define CYDER_CANVASCOMMANDBUFFER_H
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include "CanvasRenderingContext2D.h"
+
+namespace cyder {
+
+    /**
+     * The opcodes of an encoded command buffer. Each command is one opcode word followed by its operands. Operands are
+     * 32-bit floats unless noted otherwise, colors are ARGB words.
+     */
+    enum class CanvasCommand : uint32_t {
+        SAVE = 0,
+        RESTORE = 1,
+        SET_TRANSFORM = 2,       // a, b, c, d, e, f
+        TRANSFORM = 3,           // a, b, c, d, e, f
+        TRANSLATE = 4,           // x, y
+        ROTATE = 5,              // angle
+        SCALE = 6,               // x, y
+        GLOBAL_ALPHA = 7,        // alpha
+        FILL_STYLE = 8,          // color word
+        STROKE_STYLE = 9,        // color word
+        LINE_WIDTH = 10,         // width
+        BEGIN_PATH = 11,
+        CLOSE_PATH = 12,
+        MOVE_TO = 13,            // x, y
+        LINE_TO = 14,            // x, y
+        QUADRATIC_CURVE_TO = 15, // cpx, cpy, x, y
+        BEZIER_CURVE_TO = 16,    // cp1x, cp1y, cp2x, cp2y, x, y
+        ARC = 17,                // x, y, radius, startAngle, endAngle, anticlockwise word
+        RECT = 18,               // x, y, width, height
+        FILL = 19,               // fill rule word, 0 for nonzero and 1 for evenodd
+        STROKE = 20,
+        FILL_RECT = 21,          // x, y, width, height
+        STROKE_RECT = 22,        // x, y, width, height
+        CLEAR_RECT = 23,         // x, y, width, height
+        DRAW_IMAGE = 24          // image index word, sx, sy, sw, sh, dx, dy, dw, dh
+    };
+
+    /**
+     * Executes drawing commands that scripts encoded into a typed array, so a whole batch of 2d calls costs one call
+     * into native code instead of one for each draw.
+     */
+    class CanvasCommandBuffer {
+    public:
+        /**
+         * Executes the encoded commands on the context.
+         * @param data The encoded words, opcodes and color words as uint32 and all the other operands as float32.
+         * @param length The number of words to execute.
+         * @param images The images referenced by the DRAW_IMAGE commands, by index. Null entries are skipped.
+         * @returns false if the data is malformed, in which case the commands before the malformed one have been
+         * executed.
+         */
+        static bool Execute(CanvasRenderingContext2D* context, const void* data, size_t length,
+                            const std::vector<CanvasImageSource*>& images);
+    };
+
+}
+
+#endif //CYDER_CANVASCOMMANDBUFFER_H
@@ -26,13 +26,415 @@
 
 #include "CanvasRenderingContext2D.h"
 #include <cmath>
+#include <cstring>
+#include <algorithm>
 #include "utils/USE.h"
+#include "utils/PixelConversion.h"
+#include "platform/AnimationFrame.h"
 
 namespace cyder {
-    CanvasRenderingContext2D::CanvasRenderingContext2D(DrawingBuffer* buffer) : buffer(buffer) {
+    std::vector<CanvasRenderingContext2D*>* CanvasRenderingContext2D::deferredContexts = nullptr;
+
+    void CanvasRenderingContext2D::FlushAll() {
+        if (!deferredContexts) {
+            return;
+        }
+        std::vector<CanvasRenderingContext2D*> contexts;
+        contexts.swap(*deferredContexts);
+        for (auto context : contexts) {
+            context->flush();
+        }
+    }
+
+    static void flushAtFrameEnd(double timestamp) {
+        CanvasRenderingContext2D::FlushAll();
+    }
+
+    CanvasRenderingContext2D::CanvasRenderingContext2D(DrawingBuffer* buffer, bool deferred) :
+            buffer(buffer), _deferred(deferred) {
+        State initialState;
+        initialState.matrix.reset();
+        initialState.fillStyle = SK_ColorBLACK;
+        initialState.strokeStyle = SK_ColorBLACK;
+        initialState.lineWidth = 1;
+        initialState.miterLimit = 10;
+        initialState.lineCap = SkPaint::kButt_Cap;
+        initialState.lineJoin = SkPaint::kMiter_Join;
+        initialState.globalAlpha = 1;
+        initialState.compositeOperation = SkBlendMode::kSrcOver;
+        initialState.imageSmoothingEnabled = true;
+        initialState.font = Font::Default();
+        initialState.textAlign = TextAlign::START;
+        initialState.textBaseline = TextBaseline::ALPHABETIC;
+        stateStack.push_back(initialState);
+        state = &stateStack.back();
+        fillPaint.setAntiAlias(true);
+        strokePaint.setAntiAlias(true);
+        strokePaint.setStyle(SkPaint::kStroke_Style);
+        clearPaint.setBlendMode(SkBlendMode::kClear);
     }
 
     CanvasRenderingContext2D::~CanvasRenderingContext2D() {
+        if (recorder && recorder->getRecordingCanvas()) {
+            auto contexts = deferredContexts;
+            auto result = std::find(contexts->begin(), contexts->end(), this);
+            if (result != contexts->end()) {
+                contexts->erase(result);
+            }
+            recorder->finishRecordingAsPicture();
+        }
+        delete recorder;
+        SkSafeUnref(lastFrame);
+    }
+
+    SkCanvas* CanvasRenderingContext2D::getCanvas() {
+        if (!_deferred) {
+            return buffer->getCanvas();
+        }
+        if (!recorder) {
+            recorder = new SkPictureRecorder();
+        }
+        auto canvas = recorder->getRecordingCanvas();
+        if (canvas) {
+            return canvas;
+        }
+        if (!deferredContexts) {
+            deferredContexts = new std::vector<CanvasRenderingContext2D*>();
+        }
+        if (deferredContexts->empty() && !AnimationFrame::InFrameUpdate()) {
+            // Drawing may also happen outside of a frame callback, make sure there is a frame end to flush at.
+            AnimationFrame::Request(flushAtFrameEnd);
+        }
+        deferredContexts->push_back(this);
+        return recorder->beginRecording(SkRect::MakeIWH(buffer->width(), buffer->height()));
+    }
+
+    void CanvasRenderingContext2D::flush() {
+        if (!recorder || !recorder->getRecordingCanvas()) {
+            return;
+        }
+        auto contexts = deferredContexts;
+        auto result = std::find(contexts->begin(), contexts->end(), this);
+        if (result != contexts->end()) {
+            contexts->erase(result);
+        }
+        SkSafeUnref(lastFrame);
+        lastFrame = recorder->finishRecordingAsPicture().release();
+        // The damage has been reported while recording.
+        buffer->getCanvas()->drawPicture(lastFrame);
+    }
+
+    bool CanvasRenderingContext2D::replayLastFrame() {
+        if (!lastFrame) {
+            return false;
+        }
+        auto picture = sk_ref_sp(lastFrame);
+        // Keep the order of the commands recorded before this call.
+        flush();
+        buffer->getCanvas()->drawPicture(picture.get());
+        buffer->damageAll();
+        return true;
+    }
+
+    SkCanvas* CanvasRenderingContext2D::prepareCanvas() {
+        auto canvas = getCanvas();
+        // Comparing is cheaper than recording a redundant matrix change for every draw call.
+        if (canvas->getTotalMatrix() != state->matrix) {
+            canvas->setMatrix(state->matrix);
+        }
+        return canvas;
+    }
+
+    void CanvasRenderingContext2D::updateMatrix(const SkMatrix& matrix) {
+        state->matrix = matrix;
+        SkMatrix inverse;
+        if (!matrix.invert(&inverse)) {
+            // A scale(0, 1) in a flip animation must not collapse the path, it is mapped once the matrix recovers.
+            pathMatrixIsCurrent = false;
+            return;
+        }
+        if (!_currentPath.path().isEmpty() && matrix != pathMatrix) {
+            inverse.preConcat(pathMatrix);
+            _currentPath.transform(inverse);
+        }
+        pathMatrix = matrix;
+        pathMatrixIsCurrent = true;
+    }
+
+    void CanvasRenderingContext2D::save() {
+        stateStack.push_back(*state);
+        state = &stateStack.back();
+    }
+
+    void CanvasRenderingContext2D::restore() {
+        if (stateStack.size() <= 1) {
+            return;
+        }
+        SkMatrix matrix = stateStack[stateStack.size() - 2].matrix;
+        updateMatrix(matrix);
+        stateStack.pop_back();
+        state = &stateStack.back();
+        dirtyPaints = ALL_PAINTS;
+    }
+
+    static inline bool isFinite(float a, float b, float c, float d, float e, float f) {
+        return std::isfinite(a) && std::isfinite(b) && std::isfinite(c) && std::isfinite(d) && std::isfinite(e) &&
+               std::isfinite(f);
+    }
+
+    void CanvasRenderingContext2D::setTransform(float a, float b, float c, float d, float e, float f) {
+        if (!isFinite(a, b, c, d, e, f)) {
+            return;
+        }
+        SkMatrix matrix;
+        matrix.setAll(a, c, e, b, d, f, 0, 0, 1);
+        updateMatrix(matrix);
+    }
+
+    void CanvasRenderingContext2D::transform(float a, float b, float c, float d, float e, float f) {
+        if (!isFinite(a, b, c, d, e, f)) {
+            return;
+        }
+        SkMatrix transform;
+        transform.setAll(a, c, e, b, d, f, 0, 0, 1);
+        SkMatrix matrix = state->matrix;
+        matrix.preConcat(transform);
+        updateMatrix(matrix);
+    }
+
+    void CanvasRenderingContext2D::resetTransform() {
+        updateMatrix(SkMatrix::I());
+    }
+
+    void CanvasRenderingContext2D::translate(float x, float y) {
+        if (!std::isfinite(x) || !std::isfinite(y)) {
+            return;
+        }
+        SkMatrix matrix = state->matrix;
+        matrix.preTranslate(x, y);
+        updateMatrix(matrix);
+    }
+
+    void CanvasRenderingContext2D::rotate(float angle) {
+        if (!std::isfinite(angle)) {
+            return;
+        }
+        SkMatrix matrix = state->matrix;
+        matrix.preRotate(SkRadiansToDegrees(angle));
+        updateMatrix(matrix);
+    }
+
+    void CanvasRenderingContext2D::scale(float x, float y) {
+        if (!std::isfinite(x) || !std::isfinite(y)) {
+            return;
+        }
+        SkMatrix matrix = state->matrix;
+        matrix.preScale(x, y);
+        updateMatrix(matrix);
+    }
+
+    void CanvasRenderingContext2D::setGlobalAlpha(float value) {
+        if (!(value >= 0 && value <= 1) || value == state->globalAlpha) {
+            return;
+        }
+        state->globalAlpha = value;
+        dirtyPaints = ALL_PAINTS;
+    }
+
+    void CanvasRenderingContext2D::setGlobalCompositeOperation(SkBlendMode mode) {
+        if (mode == state->compositeOperation) {
+            return;
+        }
+        state->compositeOperation = mode;
+        dirtyPaints = ALL_PAINTS;
+    }
+
+    void CanvasRenderingContext2D::setImageSmoothingEnabled(bool value) {
+        if (value == state->imageSmoothingEnabled) {
+            return;
+        }
+        state->imageSmoothingEnabled = value;
+        dirtyPaints |= IMAGE_PAINT;
+    }
+
+    void CanvasRenderingContext2D::setFillStyle(SkColor color) {
+        if (color == state->fillStyle) {
+            return;
+        }
+        state->fillStyle = color;
+        dirtyPaints |= FILL_PAINT;
+    }
+
+    void CanvasRenderingContext2D::setStrokeStyle(SkColor color) {
+        if (color == state->strokeStyle) {
+            return;
+        }
+        state->strokeStyle = color;
+        dirtyPaints |= STROKE_PAINT;
+    }
+
+    void CanvasRenderingContext2D::setLineWidth(float value) {
+        if (!std::isfinite(value) || value <= 0) {
+            return;
+        }
+        state->lineWidth = value;
+        dirtyPaints |= STROKE_PAINT;
+    }
+
+    void CanvasRenderingContext2D::setLineCap(SkPaint::Cap value) {
+        state->lineCap = value;
+        dirtyPaints |= STROKE_PAINT;
+    }
+
+    void CanvasRenderingContext2D::setLineJoin(SkPaint::Join value) {
+        state->lineJoin = value;
+        dirtyPaints |= STROKE_PAINT;
+    }
+
+    void CanvasRenderingContext2D::setMiterLimit(float value) {
+        if (!std::isfinite(value) || value <= 0) {
+            return;
+        }
+        state->miterLimit = value;
+        dirtyPaints |= STROKE_PAINT;
+    }
+
+    static inline SkColor applyGlobalAlpha(SkColor color, float globalAlpha) {
+        auto alpha = static_cast<U8CPU>(SkScalarRoundToInt(SkColorGetA(color) * globalAlpha));
+        return SkColorSetA(color, alpha);
+    }
+
+    const SkPaint& CanvasRenderingContext2D::getFillPaint() {
+        if (dirtyPaints & FILL_PAINT) {
+            fillPaint.setColor(applyGlobalAlpha(state->fillStyle, state->globalAlpha));
+            fillPaint.setBlendMode(state->compositeOperation);
+            dirtyPaints &= ~FILL_PAINT;
+        }
+        return fillPaint;
+    }
+
+    const SkPaint& CanvasRenderingContext2D::getStrokePaint() {
+        if (dirtyPaints & STROKE_PAINT) {
+            strokePaint.setColor(applyGlobalAlpha(state->strokeStyle, state->globalAlpha));
+            strokePaint.setBlendMode(state->compositeOperation);
+            strokePaint.setStrokeWidth(state->lineWidth);
+            strokePaint.setStrokeMiter(state->miterLimit);
+            strokePaint.setStrokeCap(state->lineCap);
+            strokePaint.setStrokeJoin(state->lineJoin);
+            dirtyPaints &= ~STROKE_PAINT;
+        }
+        return strokePaint;
+    }
+
+    const SkPaint* CanvasRenderingContext2D::getImagePaint() {
+        if (dirtyPaints & IMAGE_PAINT) {
+            imagePaint.setAlpha(static_cast<U8CPU>(SkScalarRoundToInt(state->globalAlpha * 255)));
+            imagePaint.setBlendMode(state->compositeOperation);
+            imagePaint.setFilterQuality(state->imageSmoothingEnabled ? kLow_SkFilterQuality : kNone_SkFilterQuality);
+            dirtyPaints &= ~IMAGE_PAINT;
+        }
+        return &imagePaint;
+    }
+
+    const SkPaint* CanvasRenderingContext2D::getImagePaint(const CanvasImageSource* image) {
+        auto paint = getImagePaint();
+        if (!image->isAlphaOnly()) {
+            return paint;
+        }
+        // Skia draws alpha-only images with the color of the paint, so they work like masks of the fill style.
+        maskPaint = *paint;
+        maskPaint.setColor(applyGlobalAlpha(state->fillStyle, state->globalAlpha));
+        return &maskPaint;
+    }
+
+    void CanvasRenderingContext2D::addDamage(SkCanvas* canvas, const SkRect& rect) {
+        SkRect deviceRect;
+        canvas->getTotalMatrix().mapRect(&deviceRect, rect);
+        buffer->addDamage(deviceRect);
+    }
+
+    SkPoint CanvasRenderingContext2D::getTextOffset(const TextRun* run) const {
+        SkPoint offset = SkPoint::Make(0, 0);
+        switch (state->textAlign) {
+            case TextAlign::END:
+            case TextAlign::RIGHT:
+                offset.fX = -run->width;
+                break;
+            case TextAlign::CENTER:
+                offset.fX = -run->width / 2;
+                break;
+            default:
+                break;
+        }
+        auto font = state->font.get();
+        switch (state->textBaseline) {
+            case TextBaseline::TOP:
+                offset.fY = font->ascent();
+                break;
+            case TextBaseline::HANGING:
+                offset.fY = font->ascent() * 0.8f;
+                break;
+            case TextBaseline::MIDDLE:
+                offset.fY = (font->ascent() - font->descent()) / 2;
+                break;
+            case TextBaseline::IDEOGRAPHIC:
+            case TextBaseline::BOTTOM:
+                offset.fY = -font->descent();
+                break;
+            default:
+                break;
+        }
+        return offset;
+    }
+
+    void CanvasRenderingContext2D::drawText(const std::string& text, float x, float y, float maxWidth,
+                                            const SkPaint& paint) {
+        if (!std::isfinite(x) || !std::isfinite(y) || !(maxWidth > 0)) {
+            return;
+        }
+        auto run = TextRun::Get(text, state->font.get());
+        if (!run->blob) {
+            return;
+        }
+        auto offset = getTextOffset(run);
+        auto canvas = prepareCanvas();
+        SkRect storage;
+        SkRect bounds = paint.getStyle() == SkPaint::kFill_Style ? run->blob->bounds() :
+                        paint.computeFastStrokeBounds(run->blob->bounds(), &storage);
+        bounds.offset(offset.fX, offset.fY);
+        if (run->width <= maxWidth) {
+            canvas->drawTextBlob(run->blob.get(), x + offset.fX, y + offset.fY, paint);
+            bounds.offset(x, y);
+            addDamage(canvas, bounds);
+            return;
+        }
+        // Condense the text horizontally around the anchor point to fit in the max width.
+        canvas->save();
+        canvas->translate(x, y);
+        canvas->scale(maxWidth / run->width, 1);
+        canvas->drawTextBlob(run->blob.get(), offset.fX, offset.fY, paint);
+        addDamage(canvas, bounds);
+        canvas->restore();
+    }
+
+    void CanvasRenderingContext2D::fillText(const std::string& text, float x, float y, float maxWidth) {
+        drawText(text, x, y, maxWidth, getFillPaint());
+    }
+
+    void CanvasRenderingContext2D::strokeText(const std::string& text, float x, float y, float maxWidth) {
+        drawText(text, x, y, maxWidth, getStrokePaint());
+    }
+
+    void CanvasRenderingContext2D::measureText(const std::string& text, TextMetrics* metrics) {
+        auto run = TextRun::Get(text, state->font.get());
+        auto offset = getTextOffset(run);
+        metrics->width = run->width;
+        metrics->actualBoundingBoxLeft = -(run->bounds.fLeft + offset.fX);
+        metrics->actualBoundingBoxRight = run->bounds.fRight + offset.fX;
+        metrics->actualBoundingBoxAscent = -(run->bounds.fTop + offset.fY);
+        metrics->actualBoundingBoxDescent = run->bounds.fBottom + offset.fY;
+        metrics->fontBoundingBoxAscent = state->font->ascent() - offset.fY;
+        metrics->fontBoundingBoxDescent = state->font->descent() + offset.fY;
     }
 
     static inline SkRect normalizeRect(const SkRect& rect) {
@@ -86,6 +488,144 @@ namespace cyder {
         if (srcRect.isEmpty()) {
             return;
         }
-        image->draw(buffer->getCanvas(), dstRect, srcRect);
+        auto canvas = prepareCanvas();
+        image->draw(canvas, dstRect, srcRect, getImagePaint(image));
+        addDamage(canvas, dstRect);
+    }
+
+    static_assert(sizeof(SkRSXform) == 4 * sizeof(float), "SkRSXform must be four packed floats.");
+
+    void CanvasRenderingContext2D::drawImages(CanvasImageSource* image, const float* sourceRects,
+                                              const float* targetTransforms, const SkColor* colors, int count) {
+        if (!image || !image->width() || !image->height() || count <= 0) {
+            return;
+        }
+        atlasRects.resize(static_cast<size_t>(count));
+        auto xforms = reinterpret_cast<const SkRSXform*>(targetTransforms);
+        float left = SK_ScalarInfinity, top = SK_ScalarInfinity;
+        float right = SK_ScalarNegativeInfinity, bottom = SK_ScalarNegativeInfinity;
+        for (int i = 0; i < count; i++) {
+            const float* rect = sourceRects + i * 4;
+            atlasRects[i] = normalizeRect(SkRect::MakeXYWH(rect[0], rect[1], rect[2], rect[3]));
+            // Accumulate the bounds of the transformed sprite quad.
+            const SkRSXform& xform = xforms[i];
+            float width = atlasRects[i].width();
+            float height = atlasRects[i].height();
+            const float xs[] = {0, xform.fSCos * width, -xform.fSSin * height,
+                                xform.fSCos * width - xform.fSSin * height};
+            const float ys[] = {0, xform.fSSin * width, xform.fSCos * height,
+                                xform.fSSin * width + xform.fSCos * height};
+            for (int j = 0; j < 4; j++) {
+                left = std::min(left, xs[j] + xform.fTx);
+                right = std::max(right, xs[j] + xform.fTx);
+                top = std::min(top, ys[j] + xform.fTy);
+                bottom = std::max(bottom, ys[j] + xform.fTy);
+            }
+        }
+        auto canvas = prepareCanvas();
+        image->drawAtlas(canvas, xforms, atlasRects.data(), colors, count, getImagePaint(image));
+        addDamage(canvas, SkRect::MakeLTRB(left, top, right, bottom));
+    }
+
+    void CanvasRenderingContext2D::fill(const Path2D* path, SkPath::FillType fillType) {
+        const SkPath& skPath = path ? path->path() : _currentPath.path();
+        if (skPath.isEmpty()) {
+            return;
+        }
+        auto canvas = prepareCanvas();
+        if (skPath.getFillType() == fillType) {
+            canvas->drawPath(skPath, getFillPaint());
+        } else {
+            // The copy shares the geometry with the original path, so it keeps the cached tessellation.
+            SkPath filledPath(skPath);
+            filledPath.setFillType(fillType);
+            canvas->drawPath(filledPath, getFillPaint());
+        }
+        addDamage(canvas, skPath.getBounds());
+    }
+
+    void CanvasRenderingContext2D::stroke(const Path2D* path) {
+        const SkPath& skPath = path ? path->path() : _currentPath.path();
+        if (skPath.isEmpty()) {
+            return;
+        }
+        auto canvas = prepareCanvas();
+        canvas->drawPath(skPath, getStrokePaint());
+        SkRect storage;
+        addDamage(canvas, getStrokePaint().computeFastStrokeBounds(skPath.getBounds(), &storage));
+    }
+
+    void CanvasRenderingContext2D::fillRect(float x, float y, float width, float height) {
+        if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(width) || !std::isfinite(height) ||
+            !width || !height) {
+            return;
+        }
+        auto rect = normalizeRect(SkRect::MakeXYWH(x, y, width, height));
+        auto canvas = prepareCanvas();
+        canvas->drawRect(rect, getFillPaint());
+        addDamage(canvas, rect);
+    }
+
+    void CanvasRenderingContext2D::strokeRect(float x, float y, float width, float height) {
+        if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(width) || !std::isfinite(height) ||
+            (!width && !height)) {
+            return;
+        }
+        auto rect = normalizeRect(SkRect::MakeXYWH(x, y, width, height));
+        auto canvas = prepareCanvas();
+        canvas->drawRect(rect, getStrokePaint());
+        SkRect storage;
+        addDamage(canvas, getStrokePaint().computeFastStrokeBounds(rect, &storage));
+    }
+
+    void CanvasRenderingContext2D::clearRect(float x, float y, float width, float height) {
+        if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(width) || !std::isfinite(height) ||
+            !width || !height) {
+            return;
+        }
+        auto rect = normalizeRect(SkRect::MakeXYWH(x, y, width, height));
+        auto canvas = prepareCanvas();
+        canvas->drawRect(rect, clearPaint);
+        addDamage(canvas, rect);
+    }
+
+    void CanvasRenderingContext2D::getImageData(int x, int y, int width, int height, void* pixels) {
+        flush();
+        auto rowBytes = static_cast<size_t>(width) * 4;
+        if (!SkIRect::MakeWH(buffer->width(), buffer->height()).contains(SkIRect::MakeXYWH(x, y, width, height))) {
+            std::memset(pixels, 0, rowBytes * height);
+        }
+        // Read the native premultiplied pixels as they are and convert them in place, which is much faster than
+        // letting Skia convert them pixel by pixel.
+        auto info = SkImageInfo::MakeN32Premul(width, height);
+        if (buffer->readPixels(info, pixels, rowBytes, x, y)) {
+            PixelConversion::Unpremultiply(pixels, pixels, static_cast<size_t>(width) * height,
+                                           PixelConversion::NativeIsBGRA());
+        }
+    }
+
+    void CanvasRenderingContext2D::putImageData(const void* pixels, int width, int height, int dx, int dy,
+                                                const SkIRect& dirtyRect) {
+        SkIRect rect = dirtyRect;
+        if (!rect.intersect(SkIRect::MakeWH(width, height))) {
+            return;
+        }
+        // The surface behind the buffer may be larger than the buffer, never write outside of it.
+        if (!rect.intersect(SkIRect::MakeXYWH(-dx, -dy, buffer->width(), buffer->height()))) {
+            return;
+        }
+        // Keep the order of the commands recorded before this call.
+        flush();
+        auto rowBytes = static_cast<size_t>(width) * 4;
+        auto source = static_cast<const uint8_t*>(pixels) + rect.y() * rowBytes + rect.x() * 4;
+        auto premultipliedRowBytes = static_cast<size_t>(rect.width()) * 4;
+        std::vector<uint8_t> premultiplied(premultipliedRowBytes * rect.height());
+        bool swapRB = PixelConversion::NativeIsBGRA();
+        for (int row = 0; row < rect.height(); row++) {
+            PixelConversion::Premultiply(source + rowBytes * row, premultiplied.data() + premultipliedRowBytes * row,
+                                         static_cast<size_t>(rect.width()), swapRB);
+        }
+        auto info = SkImageInfo::MakeN32Premul(rect.width(), rect.height());
+        buffer->writePixels(info, premultiplied.data(), premultipliedRowBytes, dx + rect.x(), dy + rect.y());
     }
 }
\ No newline at end of file
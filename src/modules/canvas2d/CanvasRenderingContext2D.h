@@ -27,18 +27,291 @@
 #ifndef CYDER_CANVASRENDERINGCONTEXT2D_H
 #define CYDER_CANVASRENDERINGCONTEXT2D_H
 
+#include <string>
+#include <vector>
 #include "modules/canvas/DrawingBuffer.h"
 #include "modules/canvas/RenderingContext.h"
 #include "modules/canvas/CanvasImageSource.h"
+#include "Path2D.h"
+#include "Font.h"
+#include "TextRun.h"
+#include "TextAlign.h"
+#include "TextBaseline.h"
+#include "TextMetrics.h"
 
 namespace cyder {
 
     class CanvasRenderingContext2D : public RenderingContext {
     public:
-        explicit CanvasRenderingContext2D(DrawingBuffer* buffer);
+        /**
+         * Plays back the pending commands of all deferred contexts into their drawing buffers. It is called once at the
+         * end of each frame.
+         */
+        static void FlushAll();
+
+        /**
+         * Creates a 2d context drawing into the specified buffer.
+         * @param deferred If true, drawing commands are recorded into a display list and played back into the buffer
+         * once at the end of the frame, or whenever the buffer content is requested.
+         */
+        explicit CanvasRenderingContext2D(DrawingBuffer* buffer, bool deferred = false);
 
         ~CanvasRenderingContext2D() override;
 
+        /**
+         * Indicates whether the drawing commands are recorded and played back at the end of the frame.
+         */
+        bool deferred() const {
+            return _deferred;
+        }
+
+        /**
+         * Plays back the commands recorded since the last flush into the drawing buffer. Does nothing if the context is
+         * not deferred.
+         */
+        void flush() override;
+
+        /**
+         * Plays back the last flushed frame into the drawing buffer again without recording it, which is useful for
+         * frames that have not changed. The commands recorded since the last flush are played back first. Returns
+         * false if there is no flushed frame yet.
+         */
+        bool replayLastFrame();
+
+        /**
+         * Saves the entire state of the canvas by pushing the current state onto a stack.
+         */
+        void save();
+
+        /**
+         * Restores the most recently saved canvas state by popping the top entry in the drawing state stack. If there
+         * is no saved state, this method does nothing.
+         */
+        void restore();
+
+        /**
+         * Returns the current transformation matrix.
+         */
+        const SkMatrix& getTransform() const {
+            return state->matrix;
+        }
+
+        /**
+         * Resets the current transform to the identity matrix, and then multiplies it with the matrix described by
+         * the arguments. Non-finite values are ignored.
+         */
+        void setTransform(float a, float b, float c, float d, float e, float f);
+
+        /**
+         * Multiplies the current transformation with the matrix described by the arguments. Non-finite values are
+         * ignored.
+         */
+        void transform(float a, float b, float c, float d, float e, float f);
+
+        /**
+         * Resets the current transform to the identity matrix.
+         */
+        void resetTransform();
+
+        /**
+         * Adds a translation transformation to the current matrix.
+         */
+        void translate(float x, float y);
+
+        /**
+         * Adds a rotation to the transformation matrix. The angle is in radians.
+         */
+        void rotate(float angle);
+
+        /**
+         * Adds a scaling transformation to the canvas units by x horizontally and by y vertically.
+         */
+        void scale(float x, float y);
+
+        /**
+         * The alpha value that is applied to shapes and images before they are composited onto the canvas. Values out
+         * of the range 0.0 to 1.0 are ignored.
+         */
+        float globalAlpha() const {
+            return state->globalAlpha;
+        }
+
+        void setGlobalAlpha(float value);
+
+        /**
+         * The blend mode used to composite new shapes and images onto the canvas.
+         */
+        SkBlendMode globalCompositeOperation() const {
+            return state->compositeOperation;
+        }
+
+        void setGlobalCompositeOperation(SkBlendMode mode);
+
+        /**
+         * Indicates whether scaled images are smoothed.
+         */
+        bool imageSmoothingEnabled() const {
+            return state->imageSmoothingEnabled;
+        }
+
+        void setImageSmoothingEnabled(bool value);
+
+        /**
+         * The color to use inside shapes.
+         */
+        SkColor fillStyle() const {
+            return state->fillStyle;
+        }
+
+        void setFillStyle(SkColor color);
+
+        /**
+         * The color to use for the lines around shapes.
+         */
+        SkColor strokeStyle() const {
+            return state->strokeStyle;
+        }
+
+        void setStrokeStyle(SkColor color);
+
+        /**
+         * The thickness of lines in space units. Zero, negative, infinite and NaN values are ignored.
+         */
+        float lineWidth() const {
+            return state->lineWidth;
+        }
+
+        void setLineWidth(float value);
+
+        /**
+         * The shape used to draw the end points of lines.
+         */
+        SkPaint::Cap lineCap() const {
+            return state->lineCap;
+        }
+
+        void setLineCap(SkPaint::Cap value);
+
+        /**
+         * The shape used to join two line segments where they meet.
+         */
+        SkPaint::Join lineJoin() const {
+            return state->lineJoin;
+        }
+
+        void setLineJoin(SkPaint::Join value);
+
+        /**
+         * The miter limit ratio. Zero, negative, infinite and NaN values are ignored.
+         */
+        float miterLimit() const {
+            return state->miterLimit;
+        }
+
+        void setMiterLimit(float value);
+
+        /**
+         * The font to draw text with.
+         */
+        const Font* font() const {
+            return state->font.get();
+        }
+
+        void setFont(sk_sp<const Font> font) {
+            state->font = std::move(font);
+        }
+
+        /**
+         * The horizontal alignment of text relative to the anchor point.
+         */
+        TextAlign textAlign() const {
+            return state->textAlign;
+        }
+
+        void setTextAlign(TextAlign value) {
+            state->textAlign = value;
+        }
+
+        /**
+         * The vertical alignment of text relative to the anchor point.
+         */
+        TextBaseline textBaseline() const {
+            return state->textBaseline;
+        }
+
+        void setTextBaseline(TextBaseline value) {
+            state->textBaseline = value;
+        }
+
+        /**
+         * Returns the current default path, which the path methods of the context build. While the transformation
+         * matrix is not invertible, the path commands are ignored, like in browsers, and a scratch path is returned.
+         */
+        Path2D* currentPath() {
+            if (!pathMatrixIsCurrent) {
+                ignoredPath.reset();
+                return &ignoredPath;
+            }
+            return &_currentPath;
+        }
+
+        /**
+         * Starts a new path by emptying the list of sub-paths.
+         */
+        void beginPath() {
+            _currentPath.reset();
+        }
+
+        /**
+         * Fills a path with the current fill style.
+         * @param path The path to fill, or nullptr to fill the current default path.
+         * @param fillType The algorithm by which to determine if a point is inside a path or outside a path.
+         */
+        void fill(const Path2D* path, SkPath::FillType fillType = SkPath::kWinding_FillType);
+
+        /**
+         * Strokes a path with the current stroke style.
+         * @param path The path to stroke, or nullptr to stroke the current default path.
+         */
+        void stroke(const Path2D* path);
+
+        /**
+         * Draws a filled rectangle whose starting point is at the coordinates (x, y) with the specified width and height
+         * and whose style is determined by the fillStyle attribute.
+         */
+        void fillRect(float x, float y, float width, float height);
+
+        /**
+         * Paints a rectangle which has a starting point at (x, y) and has a w width and an h height onto the canvas,
+         * using the current stroke style.
+         */
+        void strokeRect(float x, float y, float width, float height);
+
+        /**
+         * Sets all pixels in the rectangle defined by starting point (x, y) and size (width, height) to transparent
+         * black, erasing any previously drawn content.
+         */
+        void clearRect(float x, float y, float width, float height);
+
+        /**
+         * Draws a text string at the specified coordinates, filling the string's characters with the current fill
+         * style.
+         * @param maxWidth The maximum width to draw the text in. The text is condensed horizontally to fit.
+         */
+        void fillText(const std::string& text, float x, float y, float maxWidth = SK_ScalarInfinity);
+
+        /**
+         * Draws the outlines of the characters of a text string at the specified coordinates with the current stroke
+         * style.
+         * @param maxWidth The maximum width to draw the text in. The text is condensed horizontally to fit.
+         */
+        void strokeText(const std::string& text, float x, float y, float maxWidth = SK_ScalarInfinity);
+
+        /**
+         * Measures the text with the current font, textAlign and textBaseline.
+         */
+        void measureText(const std::string& text, TextMetrics* metrics);
+
         /**
          * Draws an image onto the canvas.
          * @param image An image to draw into the context.
@@ -76,8 +349,132 @@ namespace cyder {
         void drawImage(CanvasImageSource* image, float sourceX, float sourceY, float sourceWidth, float sourceHeight,
                        float targetX, float targetY, float targetWidth, float targetHeight);
 
+        /**
+         * Copies the pixels of a rectangle of the canvas into the memory, as non-premultiplied RGBA with 4 * width bytes
+         * per row. Pixels outside of the canvas are set to transparent black. Pending commands of a deferred context
+         * are played back first.
+         * @param pixels The destination memory, at least 4 * width * height bytes.
+         */
+        void getImageData(int x, int y, int width, int height, void* pixels);
+
+        /**
+         * Copies non-premultiplied RGBA pixels into the canvas, ignoring the transformation matrix, globalAlpha and
+         * globalCompositeOperation.
+         * @param pixels The source pixels with 4 * width bytes per row.
+         * @param dx The X coordinate in the canvas at which to place the image data.
+         * @param dy The Y coordinate in the canvas at which to place the image data.
+         * @param dirtyRect The part of the image data to copy, relative to the image data.
+         */
+        void putImageData(const void* pixels, int width, int height, int dx, int dy, const SkIRect& dirtyRect);
+
+        /**
+         * Draws a batch of sprites of one image onto the canvas.
+         * @param image An image to draw into the context.
+         * @param sourceRects Four values for each sprite, the x, y, width and height of the sub-rectangle of the source
+         * image to draw.
+         * @param targetTransforms Four values for each sprite, the scaled cosine, the scaled sine, the x translation and
+         * the y translation of the sprite in the destination canvas.
+         * @param colors One ARGB color for each sprite to modulate the sprite with, or nullptr to draw the sprites
+         * unmodified.
+         * @param count The number of sprites to draw.
+         */
+        void drawImages(CanvasImageSource* image, const float* sourceRects, const float* targetTransforms,
+                        const SkColor* colors, int count);
+
     private:
+        /**
+         * A compact block of the drawing state. It holds only plain values and a font reference so that save() and
+         * restore() are plain copies, the paints are derived from it lazily.
+         */
+        struct State {
+            SkMatrix matrix;
+            SkColor fillStyle;
+            SkColor strokeStyle;
+            float lineWidth;
+            float miterLimit;
+            SkPaint::Cap lineCap;
+            SkPaint::Join lineJoin;
+            float globalAlpha;
+            SkBlendMode compositeOperation;
+            bool imageSmoothingEnabled;
+            sk_sp<const Font> font;
+            TextAlign textAlign;
+            TextBaseline textBaseline;
+        };
+
+        enum PaintFlags {
+            FILL_PAINT = 1 << 0,
+            STROKE_PAINT = 1 << 1,
+            IMAGE_PAINT = 1 << 2,
+            ALL_PAINTS = FILL_PAINT | STROKE_PAINT | IMAGE_PAINT
+        };
+
+        static std::vector<CanvasRenderingContext2D*>* deferredContexts;
+
         DrawingBuffer* buffer;
+        std::vector<SkRect> atlasRects;
+        bool _deferred;
+        std::vector<State> stateStack;
+        State* state;
+        int dirtyPaints = ALL_PAINTS;
+        SkPaint fillPaint;
+        SkPaint strokePaint;
+        SkPaint imagePaint;
+        SkPaint maskPaint;
+        SkPaint clearPaint;
+        Path2D _currentPath;
+        /**
+         * The matrix the points of the current default path are relative to, which is the last invertible matrix.
+         */
+        SkMatrix pathMatrix = SkMatrix::I();
+        bool pathMatrixIsCurrent = true;
+        Path2D ignoredPath;
+        SkPictureRecorder* recorder = nullptr;
+        SkPicture* lastFrame = nullptr;
+
+        /**
+         * Returns the canvas to draw into, which is the recording canvas for deferred contexts.
+         */
+        SkCanvas* getCanvas();
+
+        /**
+         * Returns the canvas to draw into with the current transformation matrix applied.
+         */
+        SkCanvas* prepareCanvas();
+
+        /**
+         * Replaces the current transformation matrix. The current default path is mapped into the new coordinate
+         * space so that it stays where it was drawn. A singular matrix cannot be mapped into, the path then keeps the
+         * space of the last invertible matrix until the matrix is invertible again.
+         */
+        void updateMatrix(const SkMatrix& matrix);
+
+        /**
+         * Returns the cached paints, rebuilding them first if the state they are derived from has changed.
+         */
+        const SkPaint& getFillPaint();
+
+        const SkPaint& getStrokePaint();
+
+        const SkPaint* getImagePaint();
+
+        /**
+         * Returns the image paint, or for alpha-only images a copy of it that fills them with the fill style.
+         */
+        const SkPaint* getImagePaint(const CanvasImageSource* image);
+
+        /**
+         * Returns the offset from the anchor point to the origin of the text run for the current textAlign and
+         * textBaseline.
+         */
+        SkPoint getTextOffset(const TextRun* run) const;
+
+        void drawText(const std::string& text, float x, float y, float maxWidth, const SkPaint& paint);
+
+        /**
+         * Reports a drawn rectangle, in the local coordinates of the canvas, as damage to the drawing buffer.
+         */
+        void addDamage(SkCanvas* canvas, const SkRect& rect);
     };
 
 }
@@ -0,0 +1,181 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "Font.h"
+#include <cmath>
+#include <cstdlib>
+#include <vector>
+#include "utils/StringUtil.h"
+
+namespace cyder {
+    static const size_t MAX_CACHED_FONTS = 64;
+
+    LRUCache<std::string, sk_sp<const Font>>* Font::fonts = nullptr;
+
+    static std::string trim(const std::string& text) {
+        auto start = text.find_first_not_of(" \t\n\r\f");
+        if (start == std::string::npos) {
+            return "";
+        }
+        auto end = text.find_last_not_of(" \t\n\r\f");
+        return text.substr(start, end - start + 1);
+    }
+
+    /**
+     * Parses a CSS length like "16px" or "12pt" into pixels. Relative units are resolved against the 10px default
+     * font size of the 2d context.
+     */
+    static bool parseFontSize(const std::string& text, float* size) {
+        char* end = nullptr;
+        auto value = std::strtof(text.c_str(), &end);
+        if (end == text.c_str() || !std::isfinite(value) || value < 0) {
+            return false;
+        }
+        std::string unit = StringUtil::ToLowerCase(end);
+        if (unit == "px") {
+            *size = value;
+        } else if (unit == "pt") {
+            *size = value * 4 / 3;
+        } else if (unit == "em" || unit == "rem") {
+            *size = value * 10;
+        } else if (unit == "%") {
+            *size = value / 10;
+        } else {
+            return false;
+        }
+        return true;
+    }
+
+    static SkTypeface* matchTypeface(const std::string& familyList, const SkFontStyle& style) {
+        auto families = StringUtil::Split(familyList, ",");
+        for (auto& family : families) {
+            auto name = trim(family);
+            if (name.size() >= 2 && (name[0] == '"' || name[0] == '\'') && name[name.size() - 1] == name[0]) {
+                name = name.substr(1, name.size() - 2);
+            }
+            if (name.empty()) {
+                continue;
+            }
+            auto typeface = SkTypeface::MakeFromName(name.c_str(), style);
+            if (!typeface) {
+                continue;
+            }
+            // The font manager falls back to the default typeface for unknown names, keep looking in that case unless
+            // it is the last choice.
+            SkString familyName;
+            typeface->getFamilyName(&familyName);
+            auto generic = name == "serif" || name == "sans-serif" || name == "monospace" || name == "cursive" ||
+                           name == "fantasy" || name == "system-ui";
+            if (generic || StringUtil::ToLowerCase(familyName.c_str()) == StringUtil::ToLowerCase(name)) {
+                return typeface.release();
+            }
+        }
+        return SkTypeface::MakeFromName(nullptr, style).release();
+    }
+
+    sk_sp<const Font> Font::Get(const std::string& text) {
+        if (!fonts) {
+            fonts = new LRUCache<std::string, sk_sp<const Font>>(MAX_CACHED_FONTS);
+        }
+        auto result = fonts->find(text);
+        if (result) {
+            return *result;
+        }
+        // [style] [variant] [weight] [stretch] size[/line-height] family[, family...]
+        auto slant = SkFontStyle::kUpright_Slant;
+        auto weight = static_cast<int>(SkFontStyle::kNormal_Weight);
+        auto source = trim(text);
+        std::string::size_type position = 0;
+        float size = 0;
+        bool hasSize = false;
+        while (position < source.size()) {
+            auto end = source.find_first_of(" \t\n\r\f", position);
+            if (end == std::string::npos) {
+                end = source.size();
+            }
+            auto token = source.substr(position, end - position);
+            position = source.find_first_not_of(" \t\n\r\f", end);
+            if (position == std::string::npos) {
+                position = source.size();
+            }
+            auto lowerToken = StringUtil::ToLowerCase(token);
+            if (lowerToken == "italic" || lowerToken == "oblique") {
+                slant = lowerToken == "italic" ? SkFontStyle::kItalic_Slant : SkFontStyle::kOblique_Slant;
+            } else if (lowerToken == "bold" || lowerToken == "bolder") {
+                weight = SkFontStyle::kBold_Weight;
+            } else if (lowerToken == "lighter") {
+                weight = SkFontStyle::kLight_Weight;
+            } else if (lowerToken == "normal" || lowerToken == "small-caps" ||
+                       lowerToken.find("condensed") != std::string::npos ||
+                       lowerToken.find("expanded") != std::string::npos) {
+                // Variants and stretches have no effect on the typeface match.
+            } else if (lowerToken.size() == 3 && lowerToken[1] == '0' && lowerToken[2] == '0' &&
+                       lowerToken[0] >= '1' && lowerToken[0] <= '9') {
+                weight = std::atoi(lowerToken.c_str());
+            } else {
+                auto slash = token.find('/');
+                if (!parseFontSize(token.substr(0, slash), &size)) {
+                    return nullptr;
+                }
+                hasSize = true;
+                break;
+            }
+        }
+        if (!hasSize || position >= source.size()) {
+            return nullptr;
+        }
+        SkFontStyle style(weight, SkFontStyle::kNormal_Width, slant);
+        auto typeface = matchTypeface(source.substr(position), style);
+        return *fonts->insert(text, sk_sp<const Font>(new Font(text, typeface, size)));
+    }
+
+    sk_sp<const Font> Font::Default() {
+        static sk_sp<const Font> defaultFont = Get("10px sans-serif");
+        return defaultFont;
+    }
+
+    Font::Font(const std::string& text, SkTypeface* typeface, float size) :
+            _text(text), _typeface(typeface), _size(size) {
+        SkPaint paint;
+        applyTo(&paint);
+        SkPaint::FontMetrics metrics;
+        paint.getFontMetrics(&metrics);
+        _ascent = -metrics.fAscent;
+        _descent = metrics.fDescent;
+    }
+
+    Font::~Font() {
+        SkSafeUnref(_typeface);
+    }
+
+    void Font::applyTo(SkPaint* paint) const {
+        paint->setTypeface(sk_ref_sp(_typeface));
+        paint->setTextSize(_size);
+        paint->setTextEncoding(SkPaint::kUTF8_TextEncoding);
+        paint->setAntiAlias(true);
+        paint->setSubpixelText(true);
+    }
+}
@@ -0,0 +1,107 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_FONT_H
+#define CYDER_FONT_H
+
+#include <string>
+#include <skia.h>
+#include "utils/LRUCache.h"
+
+namespace cyder {
+
+    /**
+     * A font resolved from a CSS font shorthand, e.g. "bold 16px Arial, sans-serif".
+     */
+    class Font : public SkRefCnt {
+    public:
+        /**
+         * Returns the font described by the CSS font shorthand, or nullptr if the text is not a valid font. The most
+         * recently used fonts are kept in a small cache, so setting the same text again usually returns the same
+         * object. Scripts animating the font size would create a new font for every frame, the least recently used
+         * ones are dropped from the cache and deleted once no context refers to them.
+         */
+        static sk_sp<const Font> Get(const std::string& text);
+
+        /**
+         * Returns the default font of the 2d context, "10px sans-serif".
+         */
+        static sk_sp<const Font> Default();
+
+        ~Font() override;
+
+        /**
+         * The CSS text this font was created from.
+         */
+        const std::string& text() const {
+            return _text;
+        }
+
+        SkTypeface* typeface() const {
+            return _typeface;
+        }
+
+        /**
+         * The font size in pixels.
+         */
+        float size() const {
+            return _size;
+        }
+
+        /**
+         * The distance from the baseline to the top of the font, as a positive number.
+         */
+        float ascent() const {
+            return _ascent;
+        }
+
+        /**
+         * The distance from the baseline to the bottom of the font, as a positive number.
+         */
+        float descent() const {
+            return _descent;
+        }
+
+        /**
+         * Sets up the typeface, size and encoding of the paint to measure or draw text with this font.
+         */
+        void applyTo(SkPaint* paint) const;
+
+    private:
+        static LRUCache<std::string, sk_sp<const Font>>* fonts;
+
+        Font(const std::string& text, SkTypeface* typeface, float size);
+
+        std::string _text;
+        SkTypeface* _typeface;
+        float _size;
+        float _ascent;
+        float _descent;
+    };
+
+}
+
+#endif //CYDER_FONT_H
@@ -0,0 +1,164 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "Path2D.h"
+#include <cmath>
+#include <SkParsePath.h>
+
+namespace cyder {
+
+    static const float TWO_PI = 2 * SK_ScalarPI;
+
+    static inline bool isFinite(float a, float b) {
+        return std::isfinite(a) && std::isfinite(b);
+    }
+
+    static inline bool isFinite(float a, float b, float c, float d) {
+        return isFinite(a, b) && isFinite(c, d);
+    }
+
+    Path2D* Path2D::FromSVGString(const std::string& pathData) {
+        SkPath path;
+        if (!SkParsePath::FromSVGString(pathData.c_str(), &path)) {
+            return nullptr;
+        }
+        return new Path2D(path);
+    }
+
+    void Path2D::ensureSubpath(float x, float y) {
+        // Drawing on an empty path starts a new sub-path at the first point.
+        if (_path.countVerbs() == 0) {
+            _path.moveTo(x, y);
+        }
+    }
+
+    void Path2D::closePath() {
+        if (_path.countVerbs() > 0) {
+            _path.close();
+        }
+    }
+
+    void Path2D::moveTo(float x, float y) {
+        if (!isFinite(x, y)) {
+            return;
+        }
+        _path.moveTo(x, y);
+    }
+
+    void Path2D::lineTo(float x, float y) {
+        if (!isFinite(x, y)) {
+            return;
+        }
+        ensureSubpath(x, y);
+        _path.lineTo(x, y);
+    }
+
+    void Path2D::quadraticCurveTo(float cpx, float cpy, float x, float y) {
+        if (!isFinite(cpx, cpy, x, y)) {
+            return;
+        }
+        ensureSubpath(cpx, cpy);
+        _path.quadTo(cpx, cpy, x, y);
+    }
+
+    void Path2D::bezierCurveTo(float cp1x, float cp1y, float cp2x, float cp2y, float x, float y) {
+        if (!isFinite(cp1x, cp1y, cp2x, cp2y) || !isFinite(x, y)) {
+            return;
+        }
+        ensureSubpath(cp1x, cp1y);
+        _path.cubicTo(cp1x, cp1y, cp2x, cp2y, x, y);
+    }
+
+    bool Path2D::arcTo(float x1, float y1, float x2, float y2, float radius) {
+        if (!isFinite(x1, y1, x2, y2) || !std::isfinite(radius)) {
+            return true;
+        }
+        if (radius < 0) {
+            return false;
+        }
+        ensureSubpath(x1, y1);
+        _path.arcTo(x1, y1, x2, y2, radius);
+        return true;
+    }
+
+    bool Path2D::arc(float x, float y, float radius, float startAngle, float endAngle, bool anticlockwise) {
+        if (!isFinite(x, y, radius, startAngle) || !std::isfinite(endAngle)) {
+            return true;
+        }
+        if (radius < 0) {
+            return false;
+        }
+        // Normalize the sweep as the canvas specification requires: a full circle if the angles are at least 2π
+        // apart in the direction of drawing, otherwise the sweep is wrapped into [0, 2π).
+        float sweep;
+        if (!anticlockwise) {
+            sweep = endAngle - startAngle;
+            if (sweep < TWO_PI) {
+                sweep = std::fmod(sweep, TWO_PI);
+                if (sweep < 0) {
+                    sweep += TWO_PI;
+                }
+            } else {
+                sweep = TWO_PI;
+            }
+        } else {
+            sweep = startAngle - endAngle;
+            if (sweep < TWO_PI) {
+                sweep = std::fmod(sweep, TWO_PI);
+                if (sweep < 0) {
+                    sweep += TWO_PI;
+                }
+            } else {
+                sweep = TWO_PI;
+            }
+            sweep = -sweep;
+        }
+        SkRect oval = SkRect::MakeLTRB(x - radius, y - radius, x + radius, y + radius);
+        float startDegrees = SkRadiansToDegrees(startAngle);
+        float sweepDegrees = SkRadiansToDegrees(sweep);
+        if (std::fabs(sweepDegrees) >= 360) {
+            // SkPath::arcTo() cannot handle a sweep of 360 degrees or more, draw two half circles instead.
+            float halfSweep = sweepDegrees > 0 ? 180 : -180;
+            _path.arcTo(oval, startDegrees, halfSweep, false);
+            _path.arcTo(oval, startDegrees + halfSweep, halfSweep, false);
+            return true;
+        }
+        _path.arcTo(oval, startDegrees, sweepDegrees, false);
+        return true;
+    }
+
+    void Path2D::rect(float x, float y, float width, float height) {
+        if (!isFinite(x, y, width, height)) {
+            return;
+        }
+        // The direction of the rect follows the signs of the width and height, as the canvas specification requires.
+        _path.moveTo(x, y);
+        _path.lineTo(x + width, y);
+        _path.lineTo(x + width, y + height);
+        _path.lineTo(x, y + height);
+        _path.close();
+    }
+}
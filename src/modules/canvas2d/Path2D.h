@@ -0,0 +1,127 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_PATH2D_H
+#define CYDER_PATH2D_H
+
+#include <string>
+#include <skia.h>
+
+namespace cyder {
+
+    /**
+     * A retained path. The geometry is kept in an SkPath, so drawing the same path again reuses its cached
+     * tessellation instead of building it from scratch.
+     */
+    class Path2D {
+    public:
+        /**
+         * Creates a path from SVG path data, e.g. "M10 10 h 80 v 80 h -80 Z". Returns nullptr if the data is invalid.
+         */
+        static Path2D* FromSVGString(const std::string& pathData);
+
+        Path2D() {
+        }
+
+        explicit Path2D(const SkPath& path) : _path(path) {
+        }
+
+        const SkPath& path() const {
+            return _path;
+        }
+
+        /**
+         * Removes all the subpaths.
+         */
+        void reset() {
+            _path.reset();
+        }
+
+        /**
+         * Adds the subpaths of another path to this path.
+         */
+        void addPath(const Path2D& path) {
+            _path.addPath(path._path);
+        }
+
+        /**
+         * Transforms all the points of this path by the matrix.
+         */
+        void transform(const SkMatrix& matrix) {
+            _path.transform(matrix);
+        }
+
+        /**
+         * Causes the point of the pen to move back to the start of the current sub-path.
+         */
+        void closePath();
+
+        /**
+         * Moves the starting point of a new sub-path to the (x, y) coordinates.
+         */
+        void moveTo(float x, float y);
+
+        /**
+         * Connects the last point in the sub-path to the (x, y) coordinates with a straight line.
+         */
+        void lineTo(float x, float y);
+
+        /**
+         * Adds a quadratic Bézier curve to the path.
+         */
+        void quadraticCurveTo(float cpx, float cpy, float x, float y);
+
+        /**
+         * Adds a cubic Bézier curve to the path.
+         */
+        void bezierCurveTo(float cp1x, float cp1y, float cp2x, float cp2y, float x, float y);
+
+        /**
+         * Adds a circular arc to the path with the given control points and radius, connected to the previous point by
+         * a straight line. Returns false if the radius is negative.
+         */
+        bool arcTo(float x1, float y1, float x2, float y2, float radius);
+
+        /**
+         * Adds an arc to the path which is centered at (x, y) position with the given radius, starting at startAngle
+         * and ending at endAngle going in the given direction by anticlockwise. Returns false if the radius is negative.
+         */
+        bool arc(float x, float y, float radius, float startAngle, float endAngle, bool anticlockwise);
+
+        /**
+         * Creates a path for a rectangle at position (x, y) with a size that is determined by width and height.
+         */
+        void rect(float x, float y, float width, float height);
+
+    private:
+        SkPath _path;
+
+        void ensureSubpath(float x, float y);
+    };
+
+}
+
+#endif //CYDER_PATH2D_H
@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_TEXTMETRICS_H
+#define CYDER_TEXTMETRICS_H
+
+namespace cyder {
+
+    /**
+     * The dimensions of a piece of text, relative to the anchor point given by textAlign and textBaseline.
+     */
+    struct TextMetrics {
+        /**
+         * The advance width of the text.
+         */
+        float width;
+        /**
+         * The distance from the anchor point to the left side of the inked pixels, positive to the left.
+         */
+        float actualBoundingBoxLeft;
+        /**
+         * The distance from the anchor point to the right side of the inked pixels, positive to the right.
+         */
+        float actualBoundingBoxRight;
+        /**
+         * The distance from the anchor point to the top of the inked pixels, positive upwards.
+         */
+        float actualBoundingBoxAscent;
+        /**
+         * The distance from the anchor point to the bottom of the inked pixels, positive downwards.
+         */
+        float actualBoundingBoxDescent;
+        /**
+         * The distance from the anchor point to the ascent of the font, positive upwards.
+         */
+        float fontBoundingBoxAscent;
+        /**
+         * The distance from the anchor point to the descent of the font, positive downwards.
+         */
+        float fontBoundingBoxDescent;
+    };
+
+}
+
+#endif //CYDER_TEXTMETRICS_H
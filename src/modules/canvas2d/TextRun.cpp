@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "TextRun.h"
+#include <vector>
+#include "utils/LRUCache.h"
+
+namespace cyder {
+
+    struct TextRunKey {
+        std::string text;
+        /**
+         * The CSS text of the font. Fonts dropped from their cache are deleted, so their address may be reused by a
+         * different font, but the same text always resolves to the same glyphs.
+         */
+        std::string font;
+
+        bool operator==(const TextRunKey& other) const {
+            return font == other.font && text == other.text;
+        }
+    };
+
+    struct TextRunKeyHash {
+        size_t operator()(const TextRunKey& key) const {
+            return std::hash<std::string>()(key.text) ^ (std::hash<std::string>()(key.font) << 1);
+        }
+    };
+
+    static const size_t MAX_CACHED_RUNS = 512;
+
+    static LRUCache<TextRunKey, TextRun, TextRunKeyHash>* runCache = nullptr;
+
+    static TextRun makeTextRun(const std::string& text, const Font* font) {
+        TextRun run;
+        SkPaint paint;
+        font->applyTo(&paint);
+        run.width = paint.measureText(text.c_str(), text.size(), &run.bounds);
+        auto glyphCount = paint.textToGlyphs(text.c_str(), text.size(), nullptr);
+        if (glyphCount <= 0) {
+            run.bounds.setEmpty();
+            return run;
+        }
+        SkPaint glyphPaint(paint);
+        glyphPaint.setTextEncoding(SkPaint::kGlyphID_TextEncoding);
+        SkTextBlobBuilder builder;
+        auto& buffer = builder.allocRunPosH(glyphPaint, glyphCount, 0);
+        paint.textToGlyphs(text.c_str(), text.size(), buffer.glyphs);
+        std::vector<SkScalar> advances(static_cast<size_t>(glyphCount));
+        glyphPaint.getTextWidths(buffer.glyphs, glyphCount * sizeof(SkGlyphID), advances.data());
+        SkScalar x = 0;
+        for (int i = 0; i < glyphCount; i++) {
+            buffer.pos[i] = x;
+            x += advances[i];
+        }
+        run.blob = builder.make();
+        return run;
+    }
+
+    const TextRun* TextRun::Get(const std::string& text, const Font* font) {
+        if (!runCache) {
+            runCache = new LRUCache<TextRunKey, TextRun, TextRunKeyHash>(MAX_CACHED_RUNS);
+        }
+        TextRunKey key = {text, font->text()};
+        auto run = runCache->find(key);
+        if (run) {
+            return run;
+        }
+        return runCache->insert(key, makeTextRun(text, font));
+    }
+}
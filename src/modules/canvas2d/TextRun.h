@@ -0,0 +1,64 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_TEXTRUN_H
+#define CYDER_TEXTRUN_H
+
+#include <string>
+#include <skia.h>
+#include "Font.h"
+
+namespace cyder {
+
+    /**
+     * A line of text converted to positioned glyphs with one font. The glyphs are laid out from the origin on the
+     * alphabetic baseline.
+     */
+    struct TextRun {
+        /**
+         * Returns the run of the text in the font. Runs are kept in an LRU cache keyed by the text and the font, so
+         * labels drawn again in every frame are only converted to glyphs once. The returned run stays valid until the
+         * next call.
+         */
+        static const TextRun* Get(const std::string& text, const Font* font);
+
+        /**
+         * The glyphs of the run, or nullptr if the text has no glyphs.
+         */
+        sk_sp<SkTextBlob> blob;
+        /**
+         * The advance width of the text.
+         */
+        float width;
+        /**
+         * The bounds of the inked pixels relative to the origin.
+         */
+        SkRect bounds;
+    };
+
+}
+
+#endif //CYDER_TEXTRUN_H
@@ -0,0 +1,254 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "AnimatedImage.h"
+#include <algorithm>
+#include <cmath>
+#include "utils/LRUCache.h"
+
+namespace cyder {
+
+    static const size_t DEFAULT_FRAME_CACHE_BYTES = 32 * 1024 * 1024;
+
+    /**
+     * Browsers show frames with no or a very short duration for 100ms, and many GIFs rely on it.
+     */
+    static const double MIN_FRAME_DURATION = 11;
+    static const double DEFAULT_FRAME_DURATION = 100;
+
+    struct FrameKey {
+        const AnimatedImage* image;
+        size_t index;
+
+        bool operator==(const FrameKey& other) const {
+            return image == other.image && index == other.index;
+        }
+    };
+
+    struct FrameKeyHash {
+        size_t operator()(const FrameKey& key) const {
+            return std::hash<const void*>()(key.image) ^ (key.index * 31);
+        }
+    };
+
+    typedef LRUCache<FrameKey, sk_sp<SkImage>, FrameKeyHash> FrameCache;
+
+    static FrameCache* SharedFrameCache() {
+        static FrameCache frameCache(DEFAULT_FRAME_CACHE_BYTES);
+        return &frameCache;
+    }
+
+    static std::vector<AnimatedImage*>* animatedImages = nullptr;
+
+    AnimatedImage* AnimatedImage::Decode(const void* bytes, size_t length) {
+        if (!length) {
+            return nullptr;
+        }
+        // The codec reads the frames from the data on demand, so it has to outlive the caller's bytes.
+        auto data = SkData::MakeWithCopy(bytes, length);
+        auto codec = SkCodec::NewFromData(data);
+        if (!codec) {
+            return nullptr;
+        }
+        return new AnimatedImage(data, codec);
+    }
+
+    void AnimatedImage::SetFrameCacheLimit(size_t bytes) {
+        SharedFrameCache()->setCapacity(bytes);
+    }
+
+    size_t AnimatedImage::FrameCacheUsage() {
+        return SharedFrameCache()->totalCost();
+    }
+
+    void AnimatedImage::AdvanceAll(double timestamp) {
+        if (!animatedImages) {
+            return;
+        }
+        for (auto image : *animatedImages) {
+            image->advance(timestamp);
+        }
+    }
+
+    AnimatedImage::AnimatedImage(sk_sp<SkData> data, SkCodec* codec) : data(std::move(data)), codec(codec) {
+        auto& codecInfo = codec->getInfo();
+        info = SkImageInfo::MakeN32Premul(codecInfo.width(), codecInfo.height());
+        double time = 0;
+        for (auto& frameInfo : codec->getFrameInfo()) {
+            requiredFrames.push_back(frameInfo.fRequiredFrame);
+            double duration = frameInfo.fDuration;
+            time += duration < MIN_FRAME_DURATION ? DEFAULT_FRAME_DURATION : duration;
+            frameEnds.push_back(time);
+        }
+        if (frameEnds.empty()) {
+            // Still images have no frame information.
+            requiredFrames.push_back(SkCodec::kNone);
+            frameEnds.push_back(0);
+        }
+        if (!animatedImages) {
+            animatedImages = new std::vector<AnimatedImage*>();
+        }
+        animatedImages->push_back(this);
+    }
+
+    AnimatedImage::~AnimatedImage() {
+        auto position = std::find(animatedImages->begin(), animatedImages->end(), this);
+        if (position != animatedImages->end()) {
+            animatedImages->erase(position);
+        }
+        auto frameCache = SharedFrameCache();
+        for (size_t i = 0; i < frameEnds.size(); i++) {
+            frameCache->remove({this, i});
+        }
+    }
+
+    void AnimatedImage::play() {
+        if (!_playing) {
+            _playing = true;
+            startTime = -1;
+        }
+    }
+
+    void AnimatedImage::stop() {
+        _playing = false;
+    }
+
+    void AnimatedImage::gotoFrame(int index) {
+        _currentFrame = static_cast<size_t>(std::max(0, std::min(index, frameCount() - 1)));
+        startTime = -1;
+    }
+
+    void AnimatedImage::advance(double timestamp) {
+        auto duration = frameEnds.back();
+        if (!_playing || frameEnds.size() < 2 || duration <= 0) {
+            return;
+        }
+        if (startTime < 0) {
+            startTime = timestamp - (_currentFrame > 0 ? frameEnds[_currentFrame - 1] : 0);
+        }
+        auto time = std::fmod(timestamp - startTime, duration);
+        auto frame = std::upper_bound(frameEnds.begin(), frameEnds.end(), time) - frameEnds.begin();
+        _currentFrame = std::min(static_cast<size_t>(frame), frameEnds.size() - 1);
+    }
+
+    SkImage* AnimatedImage::currentImage() {
+        if (lastFrameIndex != _currentFrame) {
+            auto frame = decodeFrame(_currentFrame);
+            if (!frame) {
+                // Keep showing the previous frame rather than nothing.
+                return lastFrame.get();
+            }
+            lastFrame = frame;
+            lastFrameIndex = _currentFrame;
+        }
+        return lastFrame.get();
+    }
+
+    sk_sp<SkImage> AnimatedImage::findFrame(size_t index) {
+        if (index == lastFrameIndex) {
+            return lastFrame;
+        }
+        auto frame = SharedFrameCache()->find({this, index});
+        return frame ? *frame : nullptr;
+    }
+
+    sk_sp<SkImage> AnimatedImage::decodeFrame(size_t index) {
+        auto frame = findFrame(index);
+        if (frame) {
+            return frame;
+        }
+        // A frame is drawn over the frame it requires. Walk back to the nearest one that is available or needs no
+        // prior frame, then compose forward from there.
+        std::vector<size_t> chain = {index};
+        sk_sp<SkImage> priorFrame;
+        auto required = requiredFrames[index];
+        while (required != SkCodec::kNone) {
+            priorFrame = findFrame(required);
+            if (priorFrame) {
+                break;
+            }
+            chain.push_back(required);
+            required = requiredFrames[required];
+        }
+        for (auto i = chain.rbegin(); i != chain.rend(); i++) {
+            priorFrame = composeFrame(*i, priorFrame);
+            if (!priorFrame) {
+                return nullptr;
+            }
+        }
+        return priorFrame;
+    }
+
+    sk_sp<SkImage> AnimatedImage::composeFrame(size_t index, const sk_sp<SkImage>& priorFrame) {
+        SkBitmap bitmap;
+        if (!bitmap.tryAllocPixels(info)) {
+            return nullptr;
+        }
+        SkCodec::Options options;
+        options.fFrameIndex = index;
+        if (priorFrame) {
+            priorFrame->readPixels(info, bitmap.getPixels(), bitmap.rowBytes(), 0, 0);
+            options.fHasPriorFrame = true;
+        } else {
+            bitmap.eraseColor(SK_ColorTRANSPARENT);
+            options.fHasPriorFrame = false;
+        }
+        auto result = codec->getPixels(info, bitmap.getPixels(), bitmap.rowBytes(), &options);
+        // An incomplete frame still shows the part that could be decoded.
+        if (result != SkCodec::kSuccess && result != SkCodec::kIncompleteInput) {
+            return nullptr;
+        }
+        bitmap.setImmutable();
+        auto frame = SkImage::MakeFromBitmap(bitmap);
+        if (frame) {
+            SharedFrameCache()->insert({this, index}, frame, info.getSafeSize(bitmap.rowBytes()));
+        }
+        return frame;
+    }
+
+    void AnimatedImage::draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect, const SkPaint* paint) {
+        auto image = currentImage();
+        if (!image || dstRect.isEmpty()) {
+            return;
+        }
+        SkRect adjustedSrcRect = srcRect;
+        adjustedSrcRect.intersect(SkRect::MakeIWH(image->width(), image->height()));
+        if (adjustedSrcRect.isEmpty()) {
+            return;
+        }
+        canvas->drawImageRect(image, adjustedSrcRect, dstRect, paint);
+    }
+
+    void AnimatedImage::drawAtlas(SkCanvas* canvas, const SkRSXform xforms[], const SkRect texRects[],
+                                  const SkColor colors[], int count, const SkPaint* paint) {
+        auto image = currentImage();
+        if (!image || count <= 0) {
+            return;
+        }
+        canvas->drawAtlas(image, xforms, texRects, colors, count, SkBlendMode::kModulate, nullptr, paint);
+    }
+
+}
@@ -0,0 +1,135 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_ANIMATEDIMAGE_H
+#define CYDER_ANIMATEDIMAGE_H
+
+#include <memory>
+#include <vector>
+#include <skia.h>
+#include "modules/canvas/CanvasImageSource.h"
+
+namespace cyder {
+
+    /**
+     * An animated GIF or WebP image. Only the encoded data is kept, each frame is decoded the first time it is drawn.
+     * Composed frames are kept in a cache shared by all animated images, which discards the least recently used frames
+     * once it is over budget. Playing images advance with the animation frame timestamps.
+     */
+    class AnimatedImage : public CanvasImageSource {
+    public:
+        /**
+         * Reads the frame information of an encoded image, or returns nullptr if the bytes can not be decoded. Still
+         * images are accepted and have one frame.
+         */
+        static AnimatedImage* Decode(const void* bytes, size_t length);
+
+        /**
+         * Sets the budget of the cache holding the composed frames of all animated images. The default is 32MB.
+         */
+        static void SetFrameCacheLimit(size_t bytes);
+
+        /**
+         * Returns the number of bytes used by the cache holding the composed frames.
+         */
+        static size_t FrameCacheUsage();
+
+        /**
+         * Moves every playing image to the frame shown at the timestamp, in milliseconds.
+         */
+        static void AdvanceAll(double timestamp);
+
+        ~AnimatedImage() override;
+
+        int width() const override {
+            return info.width();
+        }
+
+        int height() const override {
+            return info.height();
+        }
+
+        int frameCount() const {
+            return static_cast<int>(frameEnds.size());
+        }
+
+        int currentFrame() const {
+            return static_cast<int>(_currentFrame);
+        }
+
+        bool playing() const {
+            return _playing;
+        }
+
+        /**
+         * Starts advancing the frames from the current frame. Animations loop forever.
+         */
+        void play();
+
+        void stop();
+
+        /**
+         * Shows the frame at the index. A playing image continues from there.
+         */
+        void gotoFrame(int index);
+
+        void draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect,
+                  const SkPaint* paint = nullptr) override;
+
+        void drawAtlas(SkCanvas* canvas, const SkRSXform xforms[], const SkRect texRects[], const SkColor colors[],
+                       int count, const SkPaint* paint = nullptr) override;
+
+    private:
+        AnimatedImage(sk_sp<SkData> data, SkCodec* codec);
+
+        sk_sp<SkData> data;
+        std::unique_ptr<SkCodec> codec;
+        SkImageInfo info;
+        std::vector<size_t> requiredFrames;
+        /**
+         * The time each frame ends at, in milliseconds from the start of the animation.
+         */
+        std::vector<double> frameEnds;
+        size_t _currentFrame = 0;
+        bool _playing = true;
+        double startTime = -1;
+        /**
+         * The frame drawn last is always kept, so that playing in order decodes one frame at a time even when the
+         * cache is too small to hold the whole animation.
+         */
+        sk_sp<SkImage> lastFrame;
+        size_t lastFrameIndex = SkCodec::kNone;
+
+        void advance(double timestamp);
+        SkImage* currentImage();
+        sk_sp<SkImage> findFrame(size_t index);
+        sk_sp<SkImage> decodeFrame(size_t index);
+        sk_sp<SkImage> composeFrame(size_t index, const sk_sp<SkImage>& priorFrame);
+    };
+
+}
+
+#endif //CYDER_ANIMATEDIMAGE_H
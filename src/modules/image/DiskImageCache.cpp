@@ -0,0 +1,307 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "DiskImageCache.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include "platform/File.h"
+#include "platform/MappedFile.h"
+#include "utils/Hash.h"
+
+namespace cyder {
+
+    static const size_t DEFAULT_MAX_BYTES = 256 * 1024 * 1024;
+    static const char ENTRY_MAGIC[4] = {'C', 'Y', 'P', 'X'};
+    static const uint32_t ENTRY_VERSION = 1;
+    static const char* ENTRY_EXTENSION = ".pixels";
+
+    /**
+     * The header of an entry file. It is 64 bytes long, which keeps the pixels that follow it aligned.
+     */
+    struct EntryHeader {
+        char magic[4];
+        uint32_t version;
+        uint64_t keyHash;
+        int64_t sourceModificationTime;
+        int64_t sourceSize;
+        int32_t width;
+        int32_t height;
+        uint32_t rowBytes;
+        uint32_t colorType;
+        uint32_t alphaType;
+        uint8_t reserved[12];
+    };
+
+    static_assert(sizeof(EntryHeader) == 64, "The entry header must be 64 bytes long.");
+
+    static uint64_t KeyHash(const std::string& path, const ImageDecodeOptions& options) {
+        auto key = path + "\n" + std::to_string(options.maxWidth) + "x" + std::to_string(options.maxHeight) + "\n" +
+                   std::to_string(options.colorType);
+        return Hash::Bytes(key.data(), key.size());
+    }
+
+    static std::string EntryFileName(uint64_t keyHash) {
+        char name[17];
+        snprintf(name, sizeof(name), "%016llx", static_cast<unsigned long long>(keyHash));
+        return std::string(name) + ENTRY_EXTENSION;
+    }
+
+    static bool EndsWith(const std::string& text, const std::string& suffix) {
+        return text.size() >= suffix.size() && text.compare(text.size() - suffix.size(), suffix.size(), suffix) == 0;
+    }
+
+    static void ReleaseMapping(const void* pixels, void* context) {
+        delete static_cast<MappedFile*>(context);
+    }
+
+    DiskImageCache* DiskImageCache::Shared() {
+        static DiskImageCache diskImageCache(DEFAULT_MAX_BYTES);
+        return &diskImageCache;
+    }
+
+    DiskImageCache::DiskImageCache(size_t maxBytes) : _maxBytes(maxBytes) {
+    }
+
+    void DiskImageCache::setDirectory(const std::string& directory) {
+        std::lock_guard<std::mutex> lock(locker);
+        _directory.clear();
+        entries.clear();
+        _totalBytes = 0;
+        indexed = false;
+        if (directory.empty() || !File::CreateDirectories(directory)) {
+            return;
+        }
+        _directory = directory.back() == '/' ? directory : directory + "/";
+    }
+
+    std::string DiskImageCache::directory() const {
+        std::lock_guard<std::mutex> lock(locker);
+        return _directory;
+    }
+
+    void DiskImageCache::setMaxBytes(size_t maxBytes) {
+        std::lock_guard<std::mutex> lock(locker);
+        _maxBytes = maxBytes;
+        if (!_directory.empty()) {
+            buildIndex();
+            evict("");
+        }
+    }
+
+    size_t DiskImageCache::maxBytes() const {
+        std::lock_guard<std::mutex> lock(locker);
+        return _maxBytes;
+    }
+
+    size_t DiskImageCache::totalBytes() const {
+        std::lock_guard<std::mutex> lock(locker);
+        return _totalBytes;
+    }
+
+    Image* DiskImageCache::load(const std::string& path, int64_t modificationTime, const ImageDecodeOptions& options) {
+        std::string entryPath;
+        auto keyHash = KeyHash(path, options);
+        auto fileName = EntryFileName(keyHash);
+        {
+            std::lock_guard<std::mutex> lock(locker);
+            if (_directory.empty()) {
+                return nullptr;
+            }
+            buildIndex();
+            auto result = entries.find(fileName);
+            if (result == entries.end()) {
+                return nullptr;
+            }
+            result->second.lastUsed = ++useCount;
+            entryPath = _directory + fileName;
+        }
+        // Entries are replaced by renaming, so a mapped entry stays intact even if it is replaced meanwhile.
+        std::unique_ptr<MappedFile> file(MappedFile::Open(entryPath));
+        if (!file || file->size() < sizeof(EntryHeader)) {
+            return nullptr;
+        }
+        auto header = static_cast<const EntryHeader*>(file->data());
+        auto pixelBytes = static_cast<size_t>(header->rowBytes) * static_cast<size_t>(header->height);
+        auto info = SkImageInfo::Make(header->width, header->height, static_cast<SkColorType>(header->colorType),
+                                      static_cast<SkAlphaType>(header->alphaType));
+        bool valid = memcmp(header->magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC)) == 0 &&
+                     header->version == ENTRY_VERSION && header->keyHash == keyHash &&
+                     header->sourceModificationTime == modificationTime &&
+                     header->sourceSize == File::Size(path) && header->width > 0 && header->height > 0 &&
+                     (header->colorType == kN32_SkColorType || header->colorType == options.colorType) &&
+                     header->rowBytes >= info.minRowBytes() &&
+                     file->size() == sizeof(EntryHeader) + pixelBytes;
+        if (!valid) {
+            std::lock_guard<std::mutex> lock(locker);
+            if (entryPath == _directory + fileName) {
+                removeEntry(fileName);
+            }
+            return nullptr;
+        }
+        auto pixels = static_cast<const char*>(file->data()) + sizeof(EntryHeader);
+        SkPixmap pixmap(info, pixels, header->rowBytes);
+        auto mappedFile = file.release();
+        auto image = SkImage::MakeFromRaster(pixmap, ReleaseMapping, mappedFile).release();
+        if (!image) {
+            // Skia calls the release proc only when it creates the image.
+            delete mappedFile;
+            return nullptr;
+        }
+        return new Image(image);
+    }
+
+    void DiskImageCache::store(const std::string& path, int64_t modificationTime, const ImageDecodeOptions& options,
+                               Image* image) {
+        SkPixmap pixmap;
+        // Images that could not be decoded to the requested color type are kept in the native 32-bit type.
+        if (!image->skImage()->peekPixels(&pixmap) ||
+            (pixmap.colorType() != kN32_SkColorType && pixmap.colorType() != options.colorType)) {
+            return;
+        }
+        auto sourceSize = File::Size(path);
+        if (sourceSize < 0) {
+            return;
+        }
+        EntryHeader header = {};
+        memcpy(header.magic, ENTRY_MAGIC, sizeof(ENTRY_MAGIC));
+        header.version = ENTRY_VERSION;
+        header.keyHash = KeyHash(path, options);
+        header.sourceModificationTime = modificationTime;
+        header.sourceSize = sourceSize;
+        header.width = pixmap.width();
+        header.height = pixmap.height();
+        header.rowBytes = static_cast<uint32_t>(pixmap.rowBytes());
+        header.colorType = pixmap.colorType();
+        header.alphaType = pixmap.alphaType();
+        auto fileName = EntryFileName(header.keyHash);
+        auto pixelBytes = pixmap.rowBytes() * pixmap.height();
+        auto entrySize = sizeof(EntryHeader) + pixelBytes;
+        std::string directory;
+        std::string tempPath;
+        {
+            std::lock_guard<std::mutex> lock(locker);
+            if (_directory.empty() || entrySize > _maxBytes) {
+                return;
+            }
+            directory = _directory;
+            tempPath = directory + fileName + ".tmp" + std::to_string(++tempCount);
+        }
+        {
+            std::ofstream stream(tempPath, std::ios::binary | std::ios::trunc);
+            stream.write(reinterpret_cast<const char*>(&header), sizeof(header));
+            auto rows = static_cast<const char*>(pixmap.addr());
+            stream.write(rows, pixelBytes);
+            if (!stream.good()) {
+                stream.close();
+                File::Remove(tempPath);
+                return;
+            }
+        }
+        std::lock_guard<std::mutex> lock(locker);
+        // The directory may have changed while writing.
+        if (directory != _directory || !File::Rename(tempPath, directory + fileName)) {
+            File::Remove(tempPath);
+            return;
+        }
+        buildIndex();
+        auto& entry = entries[fileName];
+        _totalBytes = _totalBytes - entry.size + entrySize;
+        entry.size = entrySize;
+        entry.lastUsed = ++useCount;
+        evict(fileName);
+    }
+
+    void DiskImageCache::clear() {
+        std::lock_guard<std::mutex> lock(locker);
+        if (_directory.empty()) {
+            return;
+        }
+        buildIndex();
+        while (!entries.empty()) {
+            removeEntry(entries.begin()->first);
+        }
+    }
+
+    /**
+     * Reads the entries of the directory the first time they are needed. Older entries are used first, so they are
+     * evicted first, and the temporary files left by an interrupted write are removed.
+     */
+    void DiskImageCache::buildIndex() {
+        if (indexed) {
+            return;
+        }
+        indexed = true;
+        std::vector<std::pair<int64_t, std::string>> files;
+        for (auto& name : File::ListFiles(_directory)) {
+            auto path = _directory + name;
+            if (!EndsWith(name, ENTRY_EXTENSION)) {
+                if (name.find(ENTRY_EXTENSION) != std::string::npos) {
+                    File::Remove(path);
+                }
+                continue;
+            }
+            files.push_back({File::ModificationTime(path), name});
+        }
+        std::sort(files.begin(), files.end());
+        for (auto& file : files) {
+            auto size = static_cast<size_t>(std::max<int64_t>(0, File::Size(_directory + file.second)));
+            entries[file.second] = {size, ++useCount};
+            _totalBytes += size;
+        }
+    }
+
+    void DiskImageCache::removeEntry(const std::string& fileName) {
+        auto result = entries.find(fileName);
+        if (result == entries.end()) {
+            return;
+        }
+        _totalBytes -= result->second.size;
+        entries.erase(result);
+        File::Remove(_directory + fileName);
+    }
+
+    void DiskImageCache::evict(const std::string& keepFileName) {
+        while (_totalBytes > _maxBytes) {
+            auto oldest = entries.end();
+            for (auto i = entries.begin(); i != entries.end(); i++) {
+                if (i->first == keepFileName) {
+                    continue;
+                }
+                if (oldest == entries.end() || i->second.lastUsed < oldest->second.lastUsed) {
+                    oldest = i;
+                }
+            }
+            if (oldest == entries.end()) {
+                return;
+            }
+            removeEntry(oldest->first);
+        }
+    }
+
+}
@@ -0,0 +1,110 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_DISKIMAGECACHE_H
+#define CYDER_DISKIMAGECACHE_H
+
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include "Image.h"
+
+namespace cyder {
+
+    /**
+     * Keeps the decoded pixels of image files in a directory, so that the next start of the application maps them
+     * into memory instead of decoding the files again. Each entry is a small header followed by the raw pixels, keyed
+     * by the path of the source file and the decode size, and checked against the modification time and size of the
+     * source file. The least recently used entries are removed once the directory grows over its limit. The cache is
+     * disabled until a directory is set. It is thread-safe.
+     */
+    class DiskImageCache {
+    public:
+        /**
+         * Returns the cache used by the image loaders. Its default limit is 256MB.
+         */
+        static DiskImageCache* Shared();
+
+        explicit DiskImageCache(size_t maxBytes);
+
+        /**
+         * Sets the directory holding the cache, creating it if needed. An empty path disables the cache.
+         */
+        void setDirectory(const std::string& directory);
+
+        std::string directory() const;
+
+        void setMaxBytes(size_t maxBytes);
+
+        size_t maxBytes() const;
+
+        /**
+         * The number of bytes the entries take on disk.
+         */
+        size_t totalBytes() const;
+
+        /**
+         * Returns the cached pixels of the file, mapped into memory without copying, or nullptr if there is no valid
+         * entry. An entry left by an older version of the file is removed.
+         */
+        Image* load(const std::string& path, int64_t modificationTime, const ImageDecodeOptions& options);
+
+        /**
+         * Writes the pixels of an image decoded from the file. Images that do not have raster pixels, such as lazy
+         * images, are not stored.
+         */
+        void store(const std::string& path, int64_t modificationTime, const ImageDecodeOptions& options,
+                   Image* image);
+
+        /**
+         * Removes all the entries from the directory.
+         */
+        void clear();
+
+    private:
+        struct Entry {
+            size_t size;
+            uint64_t lastUsed;
+        };
+
+        mutable std::mutex locker;
+        std::string _directory;
+        size_t _maxBytes;
+        size_t _totalBytes = 0;
+        uint64_t useCount = 0;
+        uint64_t tempCount = 0;
+        bool indexed = false;
+        std::unordered_map<std::string, Entry> entries;
+
+        void buildIndex();
+        void removeEntry(const std::string& fileName);
+        void evict(const std::string& keepFileName);
+    };
+
+}
+
+#endif //CYDER_DISKIMAGECACHE_H
@@ -0,0 +1,62 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_ENCODEOPTIONS_H
+#define CYDER_ENCODEOPTIONS_H
+
+#include "ImageFormat.h"
+#include "PNGFilter.h"
+
+namespace cyder {
+
+    /**
+     * The options used to encode an image.
+     */
+    struct EncodeOptions {
+        ImageFormat format = ImageFormat::PNG;
+        /**
+         * A number between 0 and 1 indicating the image quality of JPEG and WEBP images. A negative value selects the
+         * default quality of the format.
+         */
+        double quality = -1;
+        /**
+         * The zlib compression level of PNG images, from 0 (no compression) to 9 (smallest size).
+         */
+        int compressionLevel = 6;
+        /**
+         * The filter applied to the rows of PNG images.
+         */
+        PNGFilter filter = PNGFilter::ADAPTIVE;
+        /**
+         * If true, large PNG images are split into horizontal bands that are compressed on separate threads. The result
+         * is slightly larger than a single-threaded encode of the same level.
+         */
+        bool parallel = true;
+    };
+
+}
+
+#endif //CYDER_ENCODEOPTIONS_H
@@ -25,21 +25,132 @@
 //////////////////////////////////////////////////////////////////////////////////////
 
 #include "Image.h"
+#include <algorithm>
+#include <climits>
+#include <memory>
+#include "PNGEncoder.h"
+#include "platform/MainThread.h"
+#include "utils/ExternalMemory.h"
+#include "utils/PixelConversion.h"
 
 namespace cyder {
-    Image* Image::Decode(const void* bytes, size_t length) {
+    /**
+     * Returns the largest sample size that still decodes the image at least as large as the requested size, so that
+     * the image is never drawn upscaled.
+     */
+    static int ComputeSampleSize(const SkImageInfo& info, const ImageDecodeOptions& options) {
+        int sampleSize = INT_MAX;
+        if (options.maxWidth > 0) {
+            sampleSize = info.width() / options.maxWidth;
+        }
+        if (options.maxHeight > 0) {
+            sampleSize = std::min(sampleSize, info.height() / options.maxHeight);
+        }
+        if (sampleSize == INT_MAX) {
+            return 1;
+        }
+        return std::max(1, sampleSize);
+    }
+
+    /**
+     * The number of pixels decoded between two progress reports.
+     */
+    static const int PROGRESSIVE_BAND_PIXELS = 1024 * 1024;
+
+    /**
+     * Decodes the scanlines of a codec that has started a top-down scanline decode. All the snapshots and the final
+     * image share the same pixels, a snapshot only covers the rows decoded before it, which are never written again.
+     */
+    static Image* DecodeInBands(SkCodec* codec, const SkImageInfo& info, const Image::DecodeProgress& progress) {
+        auto rowBytes = info.minRowBytes();
+        auto pixels = SkData::MakeUninitialized(rowBytes * info.height());
+        // Take the address before the pixels are shared, SkData only hands out writable data while it is unique.
+        auto address = static_cast<char*>(pixels->writable_data());
+        auto bandRows = std::max(1, PROGRESSIVE_BAND_PIXELS / info.width());
+        int decodedRows = 0;
+        while (decodedRows < info.height()) {
+            auto rows = std::min(bandRows, info.height() - decodedRows);
+            if (codec->getScanlines(address + decodedRows * rowBytes, rows, rowBytes) != rows) {
+                return nullptr;
+            }
+            decodedRows += rows;
+            if (decodedRows < info.height() && progress) {
+                // Every snapshot is a new SkImage, so that a GPU backed canvas uploads its pixels again. It stops at the
+                // last decoded row, the decoding thread keeps writing the rows below while the snapshot is drawn.
+                auto snapshot = SkImage::MakeRasterData(info.makeWH(info.width(), decodedRows), pixels,
+                                                        rowBytes).release();
+                if (snapshot) {
+                    progress(new Image(snapshot), info.height());
+                }
+            }
+        }
+        auto image = SkImage::MakeRasterData(info, pixels, rowBytes).release();
+        return image ? new Image(image) : nullptr;
+    }
+
+    /**
+     * Returns the color type to decode an image into, which is the native 32-bit type if the requested type cannot
+     * store the alpha channel of the image.
+     */
+    static SkColorType ChooseColorType(const SkImageInfo& codecInfo, SkColorType colorType) {
+        if ((colorType == kRGB_565_SkColorType || colorType == kGray_8_SkColorType) && !codecInfo.isOpaque()) {
+            return kN32_SkColorType;
+        }
+        return colorType;
+    }
+
+    Image* Image::Decode(const void* bytes, size_t length, const ImageDecodeOptions& options,
+                         const DecodeProgress& progress) {
         if (!length) {
             return nullptr;
         }
-        auto codec = SkCodec::NewFromData(SkData::MakeWithoutCopy(bytes, length));
+        // The Android codec can decode any format at a reduced size. For JPEG it uses DCT scaling, which skips most
+        // of the decoding work, the other formats are sampled while decoding, which still saves the full size buffer.
+        auto codec = SkAndroidCodec::NewFromData(SkData::MakeWithoutCopy(bytes, length));
         if (!codec) {
             return nullptr;
         }
 
         SkImageInfo codecInfo = codec->getInfo();
+        SkAndroidCodec::AndroidOptions androidOptions;
+        androidOptions.fSampleSize = ComputeSampleSize(codecInfo, options);
+        // Skia decodes lazy images to the native 32-bit type only.
+        if (options.lazy && androidOptions.fSampleSize == 1 && options.colorType == kN32_SkColorType) {
+            delete codec;
+            // Skia decodes lazy images on demand and keeps the pixels in its resource cache.
+            auto image = SkImage::MakeFromEncoded(SkData::MakeWithCopy(bytes, length)).release();
+            return image ? new Image(image) : nullptr;
+        }
+        if (options.progressive && androidOptions.fSampleSize == 1 && options.colorType == kN32_SkColorType) {
+            // The Android codec has no scanline decoding, but at full size the plain codec decodes the same pixels.
+            std::unique_ptr<SkCodec> scanlineCodec(SkCodec::NewFromData(SkData::MakeWithoutCopy(bytes, length)));
+            auto alphaType = codecInfo.isOpaque() ? kOpaque_SkAlphaType : kPremul_SkAlphaType;
+            auto info = SkImageInfo::MakeN32(codecInfo.width(), codecInfo.height(), alphaType);
+            if (scanlineCodec && scanlineCodec->getScanlineOrder() == SkCodec::kTopDown_SkScanlineOrder &&
+                scanlineCodec->startScanlineDecode(info) == SkCodec::kSuccess) {
+                delete codec;
+                return DecodeInBands(scanlineCodec.get(), info, progress);
+            }
+        }
+        auto size = codec->getSampledDimensions(androidOptions.fSampleSize);
+        auto alphaType = codecInfo.isOpaque() ? kOpaque_SkAlphaType : kPremul_SkAlphaType;
+        auto info = SkImageInfo::Make(size.width(), size.height(), ChooseColorType(codecInfo, options.colorType),
+                                      alphaType);
         SkBitmap bitmap;
-        bitmap.allocN32Pixels(codecInfo.width(), codecInfo.height(), codecInfo.isOpaque());
-        auto result = codec->getPixels(bitmap.info(), bitmap.getPixels(), bitmap.rowBytes());
+        bitmap.allocPixels(info);
+        auto result = codec->getAndroidPixels(info, bitmap.getPixels(), bitmap.rowBytes(), &androidOptions);
+        if (result == SkCodec::kInvalidConversion && info.colorType() != kN32_SkColorType) {
+            // The codecs only output the color types their formats store, such as gray for grayscale JPEG, the other
+            // types are converted from 32-bit pixels. Those are kept as they are if Skia cannot convert them either.
+            SkBitmap n32Bitmap;
+            n32Bitmap.allocPixels(info.makeColorType(kN32_SkColorType));
+            result = codec->getAndroidPixels(n32Bitmap.info(), n32Bitmap.getPixels(), n32Bitmap.rowBytes(),
+                                             &androidOptions);
+            if (result == SkCodec::kSuccess &&
+                !n32Bitmap.readPixels(info, bitmap.getPixels(), bitmap.rowBytes(), 0, 0)) {
+                bitmap.swap(n32Bitmap);
+            }
+        }
         delete codec;
         if (result != SkCodec::kSuccess) {
             return nullptr;
@@ -50,30 +161,65 @@ namespace cyder {
         return new Image(image);
     }
 
+    void Image::SetDecodedCacheLimit(size_t bytes) {
+        SkGraphics::SetResourceCacheTotalByteLimit(bytes);
+    }
+
+    size_t Image::DecodedCacheUsage() {
+        return SkGraphics::GetResourceCacheTotalBytesUsed();
+    }
+
     Image* Image::MakeFromPixels(const void* pixels, int width, int height, bool transparent) {
         const size_t bytesPerRow = static_cast<size_t>(4 * width);
         SkBitmap bitmap;
         bitmap.allocN32Pixels(width, height, !transparent);
-        SkCanvas canvas(bitmap);
-        SkImageInfo info = SkImageInfo::Make(width, height, kRGBA_8888_SkColorType, kUnpremul_SkAlphaType);
-        if (!canvas.writePixels(info, pixels, bytesPerRow, 0, 0)) {
-            return nullptr;
+        auto source = static_cast<const uint8_t*>(pixels);
+        auto target = static_cast<uint8_t*>(bitmap.getPixels());
+        bool swapRB = PixelConversion::NativeIsBGRA();
+        for (int row = 0; row < height; row++) {
+            PixelConversion::Premultiply(source + bytesPerRow * row, target + bitmap.rowBytes() * row,
+                                         static_cast<size_t>(width), swapRB);
         }
+        bitmap.setImmutable();
         auto image = SkImage::MakeFromBitmap(bitmap).release();
         return new Image(image);
     }
 
     Image::Image(SkImage* pixels) :
             pixels(pixels), subset(nullptr) {
+        reportExternalMemory();
     }
 
     Image::Image(SkImage* pixels, const SkIRect& subset) :
             pixels(pixels), subset(new SkIRect()) {
         *(this->subset) = subset;
+        reportExternalMemory();
     }
 
     Image::~Image() {
+        if (memoryBlock) {
+            ExternalMemory::Release(memoryBlock);
+        }
         SkSafeUnref(pixels);
+        delete subset;
+    }
+
+    void Image::reportExternalMemory() {
+        // The pixels of lazy images live in Skia's resource cache, which has its own budget.
+        if (pixels->isLazyGenerated()) {
+            return;
+        }
+        // Cache hits, subsets and snapshots share their pixels, so the pixels are counted once by their address. The
+        // progressive snapshots grow over the same memory, and texture-backed images are told apart by the SkImage.
+        SkPixmap pixmap;
+        memoryBlock = pixels->peekPixels(&pixmap) ? pixmap.addr() : pixels;
+        auto bytes = static_cast<int64_t>(pixels->width()) * pixels->height() * bytesPerPixel();
+        ExternalMemory::Retain(memoryBlock, bytes);
+    }
+
+    int Image::bytesPerPixel() const {
+        SkPixmap pixmap;
+        return pixels->peekPixels(&pixmap) ? pixmap.info().bytesPerPixel() : 4;
     }
 
     Image* Image::makeSubset(int x, int y, int width, int height, bool sharePixels) {
@@ -100,30 +246,52 @@ namespace cyder {
         }
     }
 
-    SkData* Image::encode(ImageFormat type, double quality = -1) {
+    static SkData* EncodeImage(SkImage* image, const EncodeOptions& options) {
+        if (options.format == ImageFormat::PNG) {
+            return PNGEncoder::Encode(image, options);
+        }
         SkEncodedImageFormat encodeType;
-        if (type == ImageFormat::JPEG) {
+        double quality = options.quality;
+        if (options.format == ImageFormat::JPEG) {
             encodeType = SkEncodedImageFormat::kJPEG;
             if (quality < 0) {
                 quality = 0.92;
             }
-        } else if (type == ImageFormat::WEBP) {
+        } else {
             encodeType = SkEncodedImageFormat::kWEBP;
             if (quality < 0) {
                 quality = 0.8;
             }
-        } else {
-            encodeType = SkEncodedImageFormat::kPNG;
-            quality = 1;
         }
         int compressionQuality = static_cast<int>(quality);
         if (quality >= 0.0 && quality <= 1.0) {
             compressionQuality = static_cast<int>(quality * 100 + 0.5);
         }
+        return image->encode(encodeType, compressionQuality);
+    }
+
+    SkData* Image::encode(const EncodeOptions& options) {
         if (subset) {
-            return pixels->makeSubset(*subset)->encode(encodeType, compressionQuality);
+            return EncodeImage(pixels->makeSubset(*subset).get(), options);
         }
-        return pixels->encode(encodeType, compressionQuality);
+        return EncodeImage(pixels, options);
+    }
+
+    void Image::encodeAsync(const EncodeOptions& options, const std::function<void(SkData* data)>& callback) {
+        // Texture-backed pixels can only be read on the main thread, so read them back here and leave the worker an
+        // immutable raster image.
+        auto source = subset ? pixels->makeSubset(*subset) : sk_ref_sp(pixels);
+        if (source && source->isTextureBacked()) {
+            source = source->makeNonTextureImage();
+        }
+        auto result = std::make_shared<sk_sp<SkData>>();
+        MainThread::PostBackgroundTask([=]() {
+            if (source) {
+                result->reset(EncodeImage(source.get(), options));
+            }
+        }, [=]() {
+            callback(result->release());
+        });
     }
 
     bool Image::readPixels(void* buffer, int x, int y, int width, int height) {
@@ -135,11 +303,24 @@ namespace cyder {
         if (!bounds.contains(rect)) {
             return false;
         }
+        auto bytesPerRow = static_cast<size_t>(4 * width);
+        SkPixmap pixmap;
+        if (pixels->peekPixels(&pixmap) && pixmap.colorType() == kN32_SkColorType &&
+            pixmap.alphaType() != kUnpremul_SkAlphaType) {
+            // Raster images are converted straight from their pixel memory instead of Skia's generic conversion.
+            auto target = static_cast<uint8_t*>(buffer);
+            bool swapRB = PixelConversion::NativeIsBGRA();
+            for (int row = 0; row < height; row++) {
+                PixelConversion::Unpremultiply(pixmap.addr(rect.x(), rect.y() + row), target + bytesPerRow * row,
+                                               static_cast<size_t>(width), swapRB);
+            }
+            return true;
+        }
         SkImageInfo info = SkImageInfo::Make(width, height, kRGBA_8888_SkColorType, kUnpremul_SkAlphaType);
-        return pixels->readPixels(info, buffer, static_cast<size_t>(4 * width), rect.x(), rect.y());
+        return pixels->readPixels(info, buffer, bytesPerRow, rect.x(), rect.y());
     }
 
-    void Image::draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect) {
+    void Image::draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect, const SkPaint* paint) {
         SkRect adjustedSrcRect = srcRect;
         if(subset){
             adjustedSrcRect.offset(subset->fLeft,subset->fTop);
@@ -150,6 +331,46 @@ namespace cyder {
         if (adjustedSrcRect.isEmpty() || dstRect.isEmpty()){
             return;  // Nothing to draw.
         }
-        canvas->drawImageRect(pixels, adjustedSrcRect, dstRect, nullptr);
+        canvas->drawImageRect(pixels, adjustedSrcRect, dstRect, paint);
+    }
+
+    void Image::drawAtlas(SkCanvas* canvas, const SkRSXform xforms[], const SkRect texRects[], const SkColor colors[],
+                          int count, const SkPaint* paint) {
+        if (count <= 0) {
+            return;
+        }
+        // The texture rects are relative to the subset, move them into the shared pixels and keep them inside the
+        // bounds so that sprites never sample the neighbouring pixels. A clipped sprite is moved by the clipped amount
+        // in its own rotated and scaled space, so that its visible part stays in place.
+        const SkRect bounds = subset ? SkRect::Make(*subset) : SkRect::MakeIWH(pixels->width(), pixels->height());
+        bool clipped = false;
+        clippedTexRects.resize(static_cast<size_t>(count));
+        clippedXforms.assign(xforms, xforms + count);
+        for (int i = 0; i < count; i++) {
+            SkRect& rect = clippedTexRects[i];
+            rect = texRects[i];
+            rect.offset(bounds.fLeft, bounds.fTop);
+            if (bounds.contains(rect)) {
+                continue;
+            }
+            clipped = true;
+            SkRect visible = rect;
+            if (!visible.intersect(bounds)) {
+                rect.setEmpty();
+                continue;
+            }
+            float dx = visible.fLeft - rect.fLeft;
+            float dy = visible.fTop - rect.fTop;
+            SkRSXform& xform = clippedXforms[i];
+            xform.fTx += xform.fSCos * dx - xform.fSSin * dy;
+            xform.fTy += xform.fSSin * dx + xform.fSCos * dy;
+            rect = visible;
+        }
+        if (!subset && !clipped) {
+            canvas->drawAtlas(pixels, xforms, texRects, colors, count, SkBlendMode::kModulate, nullptr, paint);
+            return;
+        }
+        canvas->drawAtlas(pixels, clippedXforms.data(), clippedTexRects.data(), colors, count, SkBlendMode::kModulate,
+                          nullptr, paint);
     }
 }
\ No newline at end of file
@@ -27,8 +27,12 @@
 #ifndef CYDER_IMAGE_H
 #define CYDER_IMAGE_H
 
+#include <cstdint>
+#include <vector>
+#include <functional>
 #include <skia.h>
-#include "ImageFormat.h"
+#include "EncodeOptions.h"
+#include "ImageDecodeOptions.h"
 #include "modules/canvas/CanvasImageSource.h"
 
 namespace cyder {
@@ -38,9 +42,38 @@ namespace cyder {
      */
     class Image : public CanvasImageSource {
     public:
-        static Image* Decode(const void* bytes, size_t length);
+        /**
+         * Receives a partially decoded image, which only holds the rows decoded so far, and the full height of the
+         * image. The receiver takes the ownership of the image.
+         */
+        typedef std::function<void(Image* image, int totalRows)> DecodeProgress;
+
+        /**
+         * Decodes an encoded image. If the options ask for a smaller size, the image is decoded at the smallest size the
+         * codec supports that is not smaller than the requested size, so the result may be somewhat larger. If the
+         * options ask for a progressive decode, the progress function is called on the decoding thread after each band
+         * of rows except the last. If the options ask for a color type the codec cannot output, the pixels are decoded
+         * to the native 32-bit type and then converted.
+         */
+        static Image* Decode(const void* bytes, size_t length, const ImageDecodeOptions& options = {},
+                             const DecodeProgress& progress = nullptr);
+        /**
+         * Sets the budget of the cache holding the pixels of lazily decoded images. When the cache goes over budget the
+         * least recently drawn images are discarded and decoded again the next time they are drawn.
+         */
+        static void SetDecodedCacheLimit(size_t bytes);
+
+        /**
+         * Returns the number of bytes used by the cache holding the pixels of lazily decoded images.
+         */
+        static size_t DecodedCacheUsage();
+
         static Image* MakeFromPixels(const void* pixels, int width, int height, bool transparent = true);
         explicit Image(SkImage* pixels);
+        /**
+         * Creates an image that shows only the subset rectangle of the pixels, sharing them instead of making a copy.
+         */
+        Image(SkImage* pixels, const SkIRect& subset);
         ~Image();
 
         int width() const override {
@@ -57,11 +90,32 @@ namespace cyder {
             return pixels->height();
         }
 
+        /**
+         * Returns the underlying pixels, which include the area outside the subset if this image is a shared subset.
+         */
+        SkImage* skImage() const {
+            return pixels;
+        }
+
         bool transparent() const {
             return !pixels->isOpaque();
         }
 
-        void draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect) override;
+        bool isAlphaOnly() const override {
+            return pixels->isAlphaOnly();
+        }
+
+        /**
+         * Returns the number of bytes each pixel takes in memory. Texture-backed and lazy images are counted as 32-bit
+         * pixels, since their real format is not visible.
+         */
+        int bytesPerPixel() const;
+
+        void draw(SkCanvas* canvas, const SkRect& dstRect, const SkRect& srcRect,
+                  const SkPaint* paint = nullptr) override;
+
+        void drawAtlas(SkCanvas* canvas, const SkRSXform xforms[], const SkRect texRects[], const SkColor colors[],
+                       int count, const SkPaint* paint = nullptr) override;
 
         /**
          * Encode the image's pixels and return the result as a new SkData, which the caller must manage (i.e. call
@@ -69,7 +123,14 @@ namespace cyder {
          *
          * If the image type cannot be encoded, or the requested encoder type is not supported, this will return nullptr.
          */
-        SkData* encode(ImageFormat type, double quality);
+        SkData* encode(const EncodeOptions& options);
+
+        /**
+         * Encodes the image's pixels on the shared thread pool, then calls the callback on the main thread with the
+         * result, which the callback must unref() when it is done. The callback receives nullptr if the image cannot be
+         * encoded. The pixels are captured when this method is called, so the image may be disposed meanwhile.
+         */
+        void encodeAsync(const EncodeOptions& options, const std::function<void(SkData* data)>& callback);
 
         /**
          * Returns a new image that is a subset of this image. The underlying implementation may share the pixels, or it
@@ -95,8 +156,14 @@ namespace cyder {
     private:
         SkImage* pixels;
         SkIRect* subset;
+        std::vector<SkRect> clippedTexRects;
+        std::vector<SkRSXform> clippedXforms;
+        /**
+         * The block of pixel memory this image is counted in, nullptr if it is not counted.
+         */
+        const void* memoryBlock = nullptr;
 
-        Image(SkImage* image, const SkIRect& subset);
+        void reportExternalMemory();
     };
 
 }
@@ -0,0 +1,205 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "ImageAtlas.h"
+#include <algorithm>
+#include <climits>
+
+namespace cyder {
+
+    /**
+     * The top edge of the packed area over a horizontal span of the page.
+     */
+    struct SkylineSegment {
+        int x;
+        int y;
+        int width;
+    };
+
+    class AtlasPage {
+    public:
+        AtlasPage(int width, int height) : width(width), height(height), usedHeight(0) {
+            skyline.push_back({0, 0, width});
+        }
+
+        /**
+         * Finds the lowest position the rectangle fits at, preferring the narrowest segment on ties, and raises the
+         * skyline over it. Returns false if the rectangle does not fit in the page.
+         */
+        bool insert(int rectWidth, int rectHeight, SkIPoint* position) {
+            int bestIndex = -1;
+            int bestY = INT_MAX;
+            int bestWidth = INT_MAX;
+            for (size_t i = 0; i < skyline.size(); i++) {
+                int y = fitAt(i, rectWidth, rectHeight);
+                if (y < 0) {
+                    continue;
+                }
+                if (y + rectHeight < bestY || (y + rectHeight == bestY && skyline[i].width < bestWidth)) {
+                    bestIndex = static_cast<int>(i);
+                    bestY = y + rectHeight;
+                    bestWidth = skyline[i].width;
+                }
+            }
+            if (bestIndex < 0) {
+                return false;
+            }
+            position->set(skyline[bestIndex].x, bestY - rectHeight);
+            addSegment(static_cast<size_t>(bestIndex), position->x(), bestY, rectWidth);
+            usedHeight = std::max(usedHeight, bestY);
+            return true;
+        }
+
+        int width;
+        int height;
+        int usedHeight;
+        std::vector<std::pair<size_t, SkIPoint>> placements;
+
+    private:
+        std::vector<SkylineSegment> skyline;
+
+        /**
+         * Returns the y the rectangle rests at when its left edge is at the segment, or -1 if it does not fit there.
+         */
+        int fitAt(size_t index, int rectWidth, int rectHeight) const {
+            int x = skyline[index].x;
+            if (x + rectWidth > width) {
+                return -1;
+            }
+            int y = 0;
+            int remaining = rectWidth;
+            while (remaining > 0) {
+                y = std::max(y, skyline[index].y);
+                if (y + rectHeight > height) {
+                    return -1;
+                }
+                remaining -= skyline[index].width;
+                index++;
+            }
+            return y;
+        }
+
+        void addSegment(size_t index, int x, int y, int segmentWidth) {
+            skyline.insert(skyline.begin() + index, {x, y, segmentWidth});
+            // Shrink or remove the segments now covered by the new one.
+            for (size_t i = index + 1; i < skyline.size(); i++) {
+                auto& previous = skyline[i - 1];
+                auto& segment = skyline[i];
+                int shrink = previous.x + previous.width - segment.x;
+                if (shrink <= 0) {
+                    break;
+                }
+                segment.x += shrink;
+                segment.width -= shrink;
+                if (segment.width > 0) {
+                    break;
+                }
+                skyline.erase(skyline.begin() + i);
+                i--;
+            }
+            // Merge the neighbouring segments at the same height.
+            for (size_t i = 0; i + 1 < skyline.size(); i++) {
+                if (skyline[i].y == skyline[i + 1].y) {
+                    skyline[i].width += skyline[i + 1].width;
+                    skyline.erase(skyline.begin() + i + 1);
+                    i--;
+                }
+            }
+        }
+    };
+
+    static SkImage* RenderPage(const AtlasPage& page, const std::vector<CanvasImageSource*>& sources) {
+        auto surface = SkSurface::MakeRaster(SkImageInfo::MakeN32Premul(page.width, page.usedHeight));
+        if (!surface) {
+            return nullptr;
+        }
+        auto canvas = surface->getCanvas();
+        canvas->clear(SK_ColorTRANSPARENT);
+        SkPaint paint;
+        paint.setBlendMode(SkBlendMode::kSrc);
+        for (auto& placement : page.placements) {
+            auto source = sources[placement.first];
+            auto srcRect = SkRect::MakeIWH(source->width(), source->height());
+            auto dstRect = srcRect.makeOffset(placement.second.x(), placement.second.y());
+            source->draw(canvas, dstRect, srcRect, &paint);
+        }
+        return surface->makeImageSnapshot().release();
+    }
+
+    std::vector<Image*> ImageAtlas::Pack(const std::vector<CanvasImageSource*>& sources, int pageSize, int padding) {
+        padding = std::max(0, padding);
+        std::vector<size_t> order;
+        for (size_t i = 0; i < sources.size(); i++) {
+            if (sources[i] && sources[i]->width() > 0 && sources[i]->height() > 0) {
+                order.push_back(i);
+            }
+        }
+        // Packing the tall sources first leaves a flatter skyline for the rest.
+        std::stable_sort(order.begin(), order.end(), [&sources](size_t a, size_t b) {
+            if (sources[a]->height() != sources[b]->height()) {
+                return sources[a]->height() > sources[b]->height();
+            }
+            return sources[a]->width() > sources[b]->width();
+        });
+        std::vector<AtlasPage> pages;
+        for (auto index : order) {
+            auto source = sources[index];
+            int rectWidth = source->width() + padding;
+            int rectHeight = source->height() + padding;
+            SkIPoint position;
+            bool placed = false;
+            for (auto& page : pages) {
+                if (page.insert(rectWidth, rectHeight, &position)) {
+                    page.placements.push_back({index, position});
+                    placed = true;
+                    break;
+                }
+            }
+            if (!placed) {
+                pages.emplace_back(std::max(pageSize, rectWidth), std::max(pageSize, rectHeight));
+                auto& page = pages.back();
+                page.insert(rectWidth, rectHeight, &position);
+                page.placements.push_back({index, position});
+            }
+        }
+        std::vector<Image*> result(sources.size(), nullptr);
+        for (auto& page : pages) {
+            auto pixels = RenderPage(page, sources);
+            if (!pixels) {
+                continue;
+            }
+            for (auto& placement : page.placements) {
+                auto source = sources[placement.first];
+                auto rect = SkIRect::MakeXYWH(placement.second.x(), placement.second.y(), source->width(),
+                                              source->height());
+                result[placement.first] = new Image(SkRef(pixels), rect);
+            }
+            pixels->unref();
+        }
+        return result;
+    }
+
+}
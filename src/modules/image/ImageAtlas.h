@@ -0,0 +1,52 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_IMAGEATLAS_H
+#define CYDER_IMAGEATLAS_H
+
+#include <vector>
+#include "Image.h"
+
+namespace cyder {
+
+    /**
+     * Packs many images into a few large pages at runtime, so that the sprites drawn from them share one backing image
+     * and can be batched into a single drawAtlas() call.
+     */
+    class ImageAtlas {
+    public:
+        /**
+         * Packs the sources into pages of pageSize x pageSize pixels at most, using a skyline bottom-left packer, and
+         * returns one image per source in the same order. Each returned image is a subset sharing the pixels of its
+         * page. A source larger than pageSize gets a page of its own. Returns nullptr in place of an empty source.
+         * @param padding The number of transparent pixels kept between two packed images.
+         */
+        static std::vector<Image*> Pack(const std::vector<CanvasImageSource*>& sources, int pageSize, int padding);
+    };
+
+}
+
+#endif //CYDER_IMAGEATLAS_H
@@ -0,0 +1,183 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "ImageCache.h"
+#include <memory>
+#include "DiskImageCache.h"
+#include "platform/File.h"
+#include "platform/MappedFile.h"
+#include "utils/Hash.h"
+
+namespace cyder {
+
+    static const size_t DEFAULT_MAX_BYTES = 64 * 1024 * 1024;
+    // The number of files remembered to refer to a cached content, each only costs a key.
+    static const size_t MAX_FILE_ALIASES = 4096;
+
+    bool ImageCacheKey::operator==(const ImageCacheKey& other) const {
+        return contentHash == other.contentHash && length == other.length &&
+               modificationTime == other.modificationTime && maxWidth == other.maxWidth &&
+               maxHeight == other.maxHeight && lazy == other.lazy && colorType == other.colorType &&
+               path == other.path;
+    }
+
+    size_t ImageCacheKeyHash::operator()(const ImageCacheKey& key) const {
+        size_t hash = key.path.empty() ? static_cast<size_t>(key.contentHash) : std::hash<std::string>()(key.path);
+        hash ^= std::hash<int64_t>()(key.modificationTime) << 1;
+        return hash ^ (static_cast<size_t>(key.maxWidth) * 31 + static_cast<size_t>(key.maxHeight));
+    }
+
+    static ImageCacheKey MakeKey(const ImageDecodeOptions& options) {
+        ImageCacheKey key;
+        key.modificationTime = 0;
+        key.contentHash = 0;
+        key.length = 0;
+        key.maxWidth = options.maxWidth;
+        key.maxHeight = options.maxHeight;
+        key.lazy = options.lazy;
+        key.colorType = options.colorType;
+        return key;
+    }
+
+    static ImageCacheKey MakeContentKey(const void* bytes, size_t length, const ImageDecodeOptions& options) {
+        auto key = MakeKey(options);
+        key.contentHash = Hash::Bytes(bytes, length);
+        key.length = length;
+        return key;
+    }
+
+    ImageCache* ImageCache::Shared() {
+        static ImageCache imageCache(DEFAULT_MAX_BYTES);
+        return &imageCache;
+    }
+
+    ImageCache::ImageCache(size_t maxBytes) : cache(maxBytes), fileAliases(MAX_FILE_ALIASES) {
+    }
+
+    Image* ImageCache::decodeFile(const std::string& path, const ImageDecodeOptions& options,
+                                  const Image::DecodeProgress& progress) {
+        auto modificationTime = File::ModificationTime(path);
+        if (modificationTime < 0) {
+            return nullptr;
+        }
+        auto key = MakeKey(options);
+        key.path = path;
+        key.modificationTime = modificationTime;
+        auto image = findFile(key);
+        if (image) {
+            return image;
+        }
+        auto diskImageCache = DiskImageCache::Shared();
+        if (!options.lazy) {
+            image = diskImageCache->load(path, modificationTime, options);
+            if (image) {
+                insert(key, image, 0);
+                return image;
+            }
+        }
+        std::unique_ptr<MappedFile> file(MappedFile::Open(path));
+        if (!file || file->size() == 0) {
+            return nullptr;
+        }
+        // The same file under another path, or already loaded from bytes, still shares the pixels.
+        auto contentKey = MakeContentKey(file->data(), file->size(), options);
+        image = decode(contentKey, file->data(), file->size(), options, progress);
+        if (image) {
+            {
+                std::lock_guard<std::mutex> lock(locker);
+                fileAliases.insert(key, contentKey);
+            }
+            if (!options.lazy) {
+                diskImageCache->store(path, modificationTime, options, image);
+            }
+        }
+        return image;
+    }
+
+    Image* ImageCache::decode(const void* bytes, size_t length, const ImageDecodeOptions& options,
+                              const Image::DecodeProgress& progress) {
+        return decode(MakeContentKey(bytes, length, options), bytes, length, options, progress);
+    }
+
+    Image* ImageCache::decode(const ImageCacheKey& key, const void* bytes, size_t length,
+                              const ImageDecodeOptions& options, const Image::DecodeProgress& progress) {
+        auto image = find(key, true);
+        if (image) {
+            return image;
+        }
+        image = Image::Decode(bytes, length, options, progress);
+        if (image) {
+            insert(key, image, length);
+        }
+        return image;
+    }
+
+    /**
+     * Returns a new image sharing the cached pixels. A file miss is not counted, it is followed by a content lookup.
+     */
+    Image* ImageCache::find(const ImageCacheKey& key, bool countMiss) {
+        std::lock_guard<std::mutex> lock(locker);
+        auto pixels = cache.find(key);
+        if (!pixels) {
+            if (countMiss) {
+                misses++;
+            }
+            return nullptr;
+        }
+        hits++;
+        return new Image(SkRef((*pixels)->skImage()));
+    }
+
+    /**
+     * Returns a new image sharing the pixels of a file, which are stored under its content key, or under the file key
+     * itself when they were loaded from the disk cache. A miss is not counted, it is followed by a content lookup.
+     */
+    Image* ImageCache::findFile(const ImageCacheKey& key) {
+        std::lock_guard<std::mutex> lock(locker);
+        auto contentKey = fileAliases.find(key);
+        auto pixels = cache.find(contentKey ? *contentKey : key);
+        if (!pixels) {
+            if (contentKey) {
+                // The content has been evicted.
+                fileAliases.remove(key);
+            }
+            return nullptr;
+        }
+        hits++;
+        return new Image(SkRef((*pixels)->skImage()));
+    }
+
+    void ImageCache::insert(const ImageCacheKey& key, Image* image, size_t encodedLength) {
+        auto pixels = image->skImage();
+        // Lazy images only keep their encoded bytes, their pixels are accounted by Skia's resource cache. The lazy
+        // option is ignored for some images, so the image itself tells whether it is lazy.
+        size_t cost = pixels->isLazyGenerated() ? encodedLength : static_cast<size_t>(pixels->width()) * pixels->height() *
+                                                   image->bytesPerPixel();
+        std::lock_guard<std::mutex> lock(locker);
+        cache.insert(key, std::unique_ptr<Image>(new Image(SkRef(pixels))), cost);
+    }
+
+}
@@ -0,0 +1,161 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_IMAGECACHE_H
+#define CYDER_IMAGECACHE_H
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <mutex>
+#include "Image.h"
+#include "utils/LRUCache.h"
+
+namespace cyder {
+
+    struct ImageCacheKey {
+        /**
+         * The resolved path of the file, empty for images decoded from bytes.
+         */
+        std::string path;
+        int64_t modificationTime;
+        /**
+         * The hash of the encoded bytes, used when there is no path.
+         */
+        uint64_t contentHash;
+        size_t length;
+        int maxWidth;
+        int maxHeight;
+        bool lazy;
+        SkColorType colorType;
+
+        bool operator==(const ImageCacheKey& other) const;
+    };
+
+    struct ImageCacheKeyHash {
+        size_t operator()(const ImageCacheKey& key) const;
+    };
+
+    /**
+     * Keeps decoded images so that loading the same file or the same bytes again shares the pixels instead of reading
+     * and decoding them again. Files are identified by their resolved path and modification time, bytes by their
+     * length and a 64-bit content hash. Decoded files are kept under their content, the file only refers to that entry,
+     * so each image is stored and charged once. The cache is thread-safe, images are decoded outside of its lock.
+     */
+    class ImageCache {
+    public:
+        /**
+         * Returns the cache used by the image loaders. Its default limit is 64MB of decoded pixels.
+         */
+        static ImageCache* Shared();
+
+        explicit ImageCache(size_t maxBytes);
+
+        /**
+         * Returns the image decoded from the file, or nullptr if the file cannot be read or decoded.
+         */
+        Image* decodeFile(const std::string& path, const ImageDecodeOptions& options,
+                          const Image::DecodeProgress& progress = nullptr);
+
+        /**
+         * Returns the image decoded from the bytes, or nullptr if they cannot be decoded.
+         */
+        Image* decode(const void* bytes, size_t length, const ImageDecodeOptions& options,
+                      const Image::DecodeProgress& progress = nullptr);
+
+        /**
+         * Sets the maximum number of bytes of decoded pixels kept, evicting the least recently used images if the cache
+         * now exceeds it. Images still referenced by scripts stay alive, only the cache drops them.
+         */
+        void setMaxBytes(size_t maxBytes) {
+            std::lock_guard<std::mutex> lock(locker);
+            cache.setCapacity(maxBytes);
+        }
+
+        size_t maxBytes() const {
+            std::lock_guard<std::mutex> lock(locker);
+            return cache.capacity();
+        }
+
+        /**
+         * The number of bytes of decoded pixels currently kept.
+         */
+        size_t totalBytes() const {
+            std::lock_guard<std::mutex> lock(locker);
+            return cache.totalCost();
+        }
+
+        size_t imageCount() const {
+            std::lock_guard<std::mutex> lock(locker);
+            return cache.size();
+        }
+
+        /**
+         * The number of loads that shared the pixels of a cached image.
+         */
+        size_t hitCount() const {
+            std::lock_guard<std::mutex> lock(locker);
+            return hits;
+        }
+
+        /**
+         * The number of loads that had to decode the image.
+         */
+        size_t missCount() const {
+            std::lock_guard<std::mutex> lock(locker);
+            return misses;
+        }
+
+        void clear() {
+            std::lock_guard<std::mutex> lock(locker);
+            cache.clear();
+            fileAliases.clear();
+        }
+
+    private:
+        mutable std::mutex locker;
+        /**
+         * Each entry holds an image of its own, which keeps the cached pixels counted as external memory after the
+         * images handed out have been collected.
+         */
+        LRUCache<ImageCacheKey, std::unique_ptr<Image>, ImageCacheKeyHash> cache;
+        /**
+         * Maps the keys of decoded files to the content keys their pixels are stored under.
+         */
+        LRUCache<ImageCacheKey, ImageCacheKey, ImageCacheKeyHash> fileAliases;
+        size_t hits = 0;
+        size_t misses = 0;
+
+        Image* find(const ImageCacheKey& key, bool countMiss);
+        Image* findFile(const ImageCacheKey& key);
+        Image* decode(const ImageCacheKey& key, const void* bytes, size_t length, const ImageDecodeOptions& options,
+                      const Image::DecodeProgress& progress);
+        void insert(const ImageCacheKey& key, Image* image, size_t encodedLength);
+    };
+
+}
+
+#endif //CYDER_IMAGECACHE_H
@@ -0,0 +1,70 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_IMAGEDECODEOPTIONS_H
+#define CYDER_IMAGEDECODEOPTIONS_H
+
+#include <skia.h>
+
+namespace cyder {
+
+    /**
+     * The options used to decode an image.
+     */
+    struct ImageDecodeOptions {
+        /**
+         * The width the image will be drawn at, at most. If it is smaller than the encoded width, the image is decoded
+         * at a reduced size, which is much faster and uses less memory. 0 means no limit.
+         */
+        int maxWidth = 0;
+        /**
+         * The height the image will be drawn at, at most. 0 means no limit.
+         */
+        int maxHeight = 0;
+        /**
+         * If true, only the encoded data is kept. The image is decoded the first time it is drawn and the decoded
+         * pixels are held in a shared cache, which discards the least recently used images once it is over budget.
+         * Ignored when the image has to be decoded at a reduced size or to another color type than the native one.
+         */
+        bool lazy = false;
+        /**
+         * If true, the image is decoded top-down in bands of rows, and a snapshot of the rows decoded so far is
+         * reported after each band. Ignored for lazy images, images decoded at a reduced size or to another color type,
+         * and formats that cannot be decoded row by row.
+         */
+        bool progressive = false;
+        /**
+         * The color type of the decoded pixels. kRGB_565_SkColorType takes half the memory of the native 32-bit type,
+         * kAlpha_8_SkColorType and kGray_8_SkColorType keep one byte per pixel, the alpha channel or the luminance.
+         * Images that have transparent pixels keep the native type when asked for kRGB_565_SkColorType or
+         * kGray_8_SkColorType, which cannot store alpha. Takes precedence over the lazy option.
+         */
+        SkColorType colorType = kN32_SkColorType;
+    };
+
+}
+
+#endif //CYDER_IMAGEDECODEOPTIONS_H
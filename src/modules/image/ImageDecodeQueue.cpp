@@ -0,0 +1,70 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "ImageDecodeQueue.h"
+#include <algorithm>
+#include <memory>
+#include "platform/MainThread.h"
+#include "utils/ThreadPool.h"
+
+namespace cyder {
+
+    ImageDecodeQueue* ImageDecodeQueue::Shared() {
+        static ImageDecodeQueue decodeQueue(ThreadPool::Shared()->threadCount() / 2);
+        return &decodeQueue;
+    }
+
+    ImageDecodeQueue::ImageDecodeQueue(int maxConcurrency) : _maxConcurrency(std::max(1, maxConcurrency)) {
+    }
+
+    void ImageDecodeQueue::post(const std::function<Image*()>& load,
+                                const std::function<void(Image* image)>& callback) {
+        pending.push_back(Task{load, callback});
+        runPending();
+    }
+
+    void ImageDecodeQueue::setMaxConcurrency(int maxConcurrency) {
+        _maxConcurrency = std::max(1, maxConcurrency);
+        runPending();
+    }
+
+    void ImageDecodeQueue::runPending() {
+        while (running < static_cast<size_t>(_maxConcurrency) && !pending.empty()) {
+            auto task = pending.front();
+            pending.pop_front();
+            running++;
+            auto result = std::make_shared<Image*>(nullptr);
+            MainThread::PostBackgroundTask([=]() {
+                *result = task.load();
+            }, [=]() {
+                running--;
+                task.callback(*result);
+                runPending();
+            });
+        }
+    }
+
+}
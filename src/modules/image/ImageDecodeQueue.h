@@ -0,0 +1,87 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_IMAGEDECODEQUEUE_H
+#define CYDER_IMAGEDECODEQUEUE_H
+
+#include <deque>
+#include <functional>
+#include "Image.h"
+
+namespace cyder {
+
+    /**
+     * Runs image loads on the shared thread pool, at most maxConcurrency of them at a time, and calls their callbacks
+     * on the main thread in the order the loads finish. Capping the concurrency keeps a burst of loads from taking all
+     * the worker threads and the memory of that many decoded images at once. Must only be used on the main thread.
+     */
+    class ImageDecodeQueue {
+    public:
+        /**
+         * Returns the queue used by the image loaders. It runs up to half as many loads as there are hardware threads.
+         */
+        static ImageDecodeQueue* Shared();
+
+        explicit ImageDecodeQueue(int maxConcurrency);
+
+        /**
+         * Queues a load. The load function runs on a worker thread and returns the loaded image, or nullptr on failure.
+         * The callback then receives that image on the main thread.
+         */
+        void post(const std::function<Image*()>& load, const std::function<void(Image* image)>& callback);
+
+        int maxConcurrency() const {
+            return _maxConcurrency;
+        }
+
+        /**
+         * Changes the number of loads that may run at the same time. Values smaller than 1 are treated as 1.
+         */
+        void setMaxConcurrency(int maxConcurrency);
+
+        /**
+         * The number of loads queued or running.
+         */
+        size_t pendingCount() const {
+            return pending.size() + running;
+        }
+
+    private:
+        struct Task {
+            std::function<Image*()> load;
+            std::function<void(Image* image)> callback;
+        };
+
+        std::deque<Task> pending;
+        size_t running = 0;
+        int _maxConcurrency;
+
+        void runPending();
+    };
+
+}
+
+#endif //CYDER_IMAGEDECODEQUEUE_H
@@ -0,0 +1,304 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "PNGEncoder.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+#include <zlib.h>
+#include "utils/ThreadPool.h"
+
+namespace cyder {
+
+    // Bands smaller than this do not pay for the extra flush marker and the lost matches across the band boundary.
+    static const size_t MIN_BAND_BYTES = 256 * 1024;
+    // The deflate window size, which is also how much of the previous band is used as the dictionary of a band.
+    static const size_t WINDOW_SIZE = 32768;
+    static const uint8_t PNG_SIGNATURE[] = {137, 80, 78, 71, 13, 10, 26, 10};
+
+    struct Band {
+        int startRow;
+        int endRow;
+        std::vector<uint8_t> output;
+        uLong adler;
+        bool succeeded;
+    };
+
+    static void WriteUint32(uint8_t* buffer, uint32_t value) {
+        buffer[0] = static_cast<uint8_t>(value >> 24);
+        buffer[1] = static_cast<uint8_t>(value >> 16);
+        buffer[2] = static_cast<uint8_t>(value >> 8);
+        buffer[3] = static_cast<uint8_t>(value);
+    }
+
+    static uint8_t* WriteChunk(uint8_t* buffer, const char type[4], const uint8_t* data, size_t length) {
+        WriteUint32(buffer, static_cast<uint32_t>(length));
+        memcpy(buffer + 4, type, 4);
+        if (length > 0) {
+            memcpy(buffer + 8, data, length);
+        }
+        auto crc = crc32(crc32(0, Z_NULL, 0), buffer + 4, static_cast<uInt>(length + 4));
+        WriteUint32(buffer + 8 + length, static_cast<uint32_t>(crc));
+        return buffer + 12 + length;
+    }
+
+    static inline uint8_t PaethPredictor(int a, int b, int c) {
+        int p = a + b - c;
+        int pa = abs(p - a);
+        int pb = abs(p - b);
+        int pc = abs(p - c);
+        if (pa <= pb && pa <= pc) {
+            return static_cast<uint8_t>(a);
+        }
+        return static_cast<uint8_t>(pb <= pc ? b : c);
+    }
+
+    static void ApplyFilter(PNGFilter filter, const uint8_t* row, const uint8_t* previous, size_t rowBytes,
+                            size_t bpp, uint8_t* output) {
+        switch (filter) {
+            case PNGFilter::SUB:
+                memcpy(output, row, bpp);
+                for (size_t i = bpp; i < rowBytes; i++) {
+                    output[i] = static_cast<uint8_t>(row[i] - row[i - bpp]);
+                }
+                break;
+            case PNGFilter::UP:
+                for (size_t i = 0; i < rowBytes; i++) {
+                    output[i] = static_cast<uint8_t>(row[i] - previous[i]);
+                }
+                break;
+            case PNGFilter::AVERAGE:
+                for (size_t i = 0; i < bpp; i++) {
+                    output[i] = static_cast<uint8_t>(row[i] - (previous[i] >> 1));
+                }
+                for (size_t i = bpp; i < rowBytes; i++) {
+                    output[i] = static_cast<uint8_t>(row[i] - ((row[i - bpp] + previous[i]) >> 1));
+                }
+                break;
+            case PNGFilter::PAETH:
+                for (size_t i = 0; i < bpp; i++) {
+                    output[i] = static_cast<uint8_t>(row[i] - previous[i]);
+                }
+                for (size_t i = bpp; i < rowBytes; i++) {
+                    output[i] = static_cast<uint8_t>(row[i] - PaethPredictor(row[i - bpp], previous[i],
+                                                                              previous[i - bpp]));
+                }
+                break;
+            default:
+                memcpy(output, row, rowBytes);
+                break;
+        }
+    }
+
+    /**
+     * Writes the filter type byte followed by the filtered row. The PNGFilter values from NONE to PAETH match the
+     * filter types of the PNG specification.
+     */
+    static void FilterRow(PNGFilter filter, const uint8_t* row, const uint8_t* previous, size_t rowBytes, size_t bpp,
+                          uint8_t* output, std::vector<uint8_t>& scratch) {
+        if (filter != PNGFilter::ADAPTIVE) {
+            output[0] = static_cast<uint8_t>(filter);
+            ApplyFilter(filter, row, previous, rowBytes, bpp, output + 1);
+            return;
+        }
+        scratch.resize(rowBytes);
+        uint64_t bestSum = UINT64_MAX;
+        for (int type = static_cast<int>(PNGFilter::NONE); type <= static_cast<int>(PNGFilter::PAETH); type++) {
+            ApplyFilter(static_cast<PNGFilter>(type), row, previous, rowBytes, bpp, scratch.data());
+            // The usual heuristic: treat the bytes as signed and prefer the row closest to zero.
+            uint64_t sum = 0;
+            for (size_t i = 0; i < rowBytes; i++) {
+                auto value = scratch[i];
+                sum += value < 128 ? value : 256 - value;
+            }
+            if (sum < bestSum) {
+                bestSum = sum;
+                output[0] = static_cast<uint8_t>(type);
+                memcpy(output + 1, scratch.data(), rowBytes);
+            }
+        }
+    }
+
+    static bool DeflateBand(const uint8_t* data, size_t length, const uint8_t* dictionary, size_t dictionaryLength,
+                            int level, int strategy, bool lastBand, std::vector<uint8_t>& output) {
+        z_stream stream;
+        memset(&stream, 0, sizeof(stream));
+        // Negative window bits produce a raw deflate stream, the zlib header and checksum are written by the caller.
+        if (deflateInit2(&stream, level, Z_DEFLATED, -15, 8, strategy) != Z_OK) {
+            return false;
+        }
+        if (dictionaryLength > 0) {
+            deflateSetDictionary(&stream, dictionary, static_cast<uInt>(dictionaryLength));
+        }
+        size_t offset = output.size();
+        output.resize(offset + deflateBound(&stream, static_cast<uLong>(length)) + 16);
+        stream.next_in = const_cast<Bytef*>(data);
+        stream.avail_in = static_cast<uInt>(length);
+        // A sync flush ends the band on a byte boundary without marking the last block, so the next band can be
+        // appended directly. Only the last band finishes the stream.
+        int flush = lastBand ? Z_FINISH : Z_SYNC_FLUSH;
+        bool succeeded = false;
+        while (true) {
+            size_t written = offset + stream.total_out;
+            if (written == output.size()) {
+                output.resize(output.size() * 2);
+            }
+            stream.next_out = output.data() + written;
+            stream.avail_out = static_cast<uInt>(output.size() - written);
+            int result = deflate(&stream, flush);
+            if (result == Z_STREAM_ERROR) {
+                break;
+            }
+            if (lastBand ? result == Z_STREAM_END : (stream.avail_in == 0 && stream.avail_out != 0)) {
+                succeeded = true;
+                break;
+            }
+        }
+        output.resize(offset + stream.total_out);
+        deflateEnd(&stream);
+        return succeeded;
+    }
+
+    SkData* PNGEncoder::Encode(SkImage* image, const EncodeOptions& options) {
+        int width = image->width();
+        int height = image->height();
+        if (width <= 0 || height <= 0) {
+            return nullptr;
+        }
+        bool opaque = image->isOpaque();
+        size_t bpp = opaque ? 3 : 4;
+        size_t rowBytes = width * bpp;
+        std::vector<uint8_t> pixels(static_cast<size_t>(width) * height * 4);
+        auto info = SkImageInfo::Make(width, height, kRGBA_8888_SkColorType, kUnpremul_SkAlphaType);
+        if (!image->readPixels(info, pixels.data(), static_cast<size_t>(width) * 4, 0, 0)) {
+            return nullptr;
+        }
+        if (opaque) {
+            // Drop the alpha channel in place, each packed pixel is written at or before the position it was read.
+            size_t pixelCount = static_cast<size_t>(width) * height;
+            auto data = pixels.data();
+            for (size_t i = 0; i < pixelCount; i++) {
+                data[i * 3] = data[i * 4];
+                data[i * 3 + 1] = data[i * 4 + 1];
+                data[i * 3 + 2] = data[i * 4 + 2];
+            }
+        }
+
+        int level = std::max(0, std::min(9, options.compressionLevel));
+        // Filtered rows are mostly small values, which Z_FILTERED compresses better, unless nothing was filtered.
+        int strategy = options.filter == PNGFilter::NONE ? Z_DEFAULT_STRATEGY : Z_FILTERED;
+        auto pool = ThreadPool::Shared();
+        size_t filteredRowBytes = rowBytes + 1;
+        size_t filteredBytes = filteredRowBytes * height;
+        int bandCount = 1;
+        if (options.parallel) {
+            auto maxBands = static_cast<int>(filteredBytes / MIN_BAND_BYTES);
+            bandCount = std::max(1, std::min(std::min(maxBands, pool->threadCount() + 1), height));
+        }
+        int rowsPerBand = (height + bandCount - 1) / bandCount;
+        bandCount = (height + rowsPerBand - 1) / rowsPerBand;
+        std::vector<Band> bands(static_cast<size_t>(bandCount));
+        for (int i = 0; i < bandCount; i++) {
+            bands[i].startRow = i * rowsPerBand;
+            bands[i].endRow = std::min(height, (i + 1) * rowsPerBand);
+        }
+
+        std::vector<uint8_t> filtered(filteredBytes);
+        std::vector<uint8_t> zeroRow(rowBytes, 0);
+        auto filterBand = [&](int index) {
+            std::vector<uint8_t> scratch;
+            auto& band = bands[index];
+            for (int y = band.startRow; y < band.endRow; y++) {
+                auto row = pixels.data() + rowBytes * y;
+                auto previous = y > 0 ? row - rowBytes : zeroRow.data();
+                FilterRow(options.filter, row, previous, rowBytes, bpp, filtered.data() + filteredRowBytes * y,
+                          scratch);
+            }
+        };
+        auto compressBand = [&](int index) {
+            auto& band = bands[index];
+            auto start = filteredRowBytes * band.startRow;
+            auto length = filteredRowBytes * (band.endRow - band.startRow);
+            auto dictionaryLength = std::min(start, WINDOW_SIZE);
+            auto data = filtered.data() + start;
+            band.adler = adler32(adler32(0, Z_NULL, 0), data, static_cast<uInt>(length));
+            band.succeeded = DeflateBand(data, length, data - dictionaryLength, dictionaryLength, level, strategy,
+                                         index == bandCount - 1, band.output);
+        };
+        if (bandCount > 1) {
+            pool->parallelFor(bandCount, filterBand);
+            pool->parallelFor(bandCount, compressBand);
+        } else {
+            filterBand(0);
+            compressBand(0);
+        }
+
+        uLong adler = adler32(0, Z_NULL, 0);
+        size_t idatBytes = 0;
+        for (auto& band : bands) {
+            if (!band.succeeded) {
+                return nullptr;
+            }
+            adler = adler32_combine(adler, band.adler,
+                                    static_cast<z_off_t>(filteredRowBytes * (band.endRow - band.startRow)));
+            idatBytes += band.output.size() + 12;
+        }
+        // The zlib header goes at the start of the first IDAT chunk and the checksum at the end of the last one.
+        uint8_t levelFlag = static_cast<uint8_t>(level < 2 ? 0 : level < 6 ? 1 : level == 6 ? 2 : 3);
+        uint8_t header[2] = {0x78, static_cast<uint8_t>(levelFlag << 6)};
+        header[1] += 31 - ((header[0] << 8) + header[1]) % 31;
+        auto& firstOutput = bands.front().output;
+        firstOutput.insert(firstOutput.begin(), header, header + 2);
+        auto& lastOutput = bands.back().output;
+        lastOutput.resize(lastOutput.size() + 4);
+        WriteUint32(lastOutput.data() + lastOutput.size() - 4, static_cast<uint32_t>(adler));
+        idatBytes += 6;
+
+        uint8_t imageHeader[13];
+        WriteUint32(imageHeader, static_cast<uint32_t>(width));
+        WriteUint32(imageHeader + 4, static_cast<uint32_t>(height));
+        imageHeader[8] = 8;  // bit depth
+        imageHeader[9] = static_cast<uint8_t>(opaque ? 2 : 6);  // color type, RGB or RGBA
+        imageHeader[10] = 0;  // compression method
+        imageHeader[11] = 0;  // filter method
+        imageHeader[12] = 0;  // interlace method
+
+        size_t totalBytes = sizeof(PNG_SIGNATURE) + (12 + sizeof(imageHeader)) + idatBytes + 12;
+        auto data = SkData::MakeUninitialized(totalBytes);
+        auto buffer = static_cast<uint8_t*>(data->writable_data());
+        memcpy(buffer, PNG_SIGNATURE, sizeof(PNG_SIGNATURE));
+        buffer += sizeof(PNG_SIGNATURE);
+        buffer = WriteChunk(buffer, "IHDR", imageHeader, sizeof(imageHeader));
+        for (auto& band : bands) {
+            buffer = WriteChunk(buffer, "IDAT", band.output.data(), band.output.size());
+        }
+        WriteChunk(buffer, "IEND", nullptr, 0);
+        return data.release();
+    }
+
+}
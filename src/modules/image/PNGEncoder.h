@@ -0,0 +1,51 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_PNGENCODER_H
+#define CYDER_PNGENCODER_H
+
+#include <skia.h>
+#include "EncodeOptions.h"
+
+namespace cyder {
+
+    /**
+     * A PNG encoder which can compress horizontal bands of an image on the shared thread pool. Each band is deflated
+     * separately and ends on a byte boundary, so the compressed bands are simply concatenated into one zlib stream,
+     * one IDAT chunk per band.
+     */
+    class PNGEncoder {
+    public:
+        /**
+         * Encodes the image and returns the result as a new SkData, which the caller must unref() when done. Returns
+         * nullptr if the pixels cannot be read. The image must be a raster image when called off the main thread.
+         */
+        static SkData* Encode(SkImage* image, const EncodeOptions& options);
+    };
+
+}
+
+#endif //CYDER_PNGENCODER_H
@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_PNGFILTER_H
+#define CYDER_PNGFILTER_H
+
+namespace cyder {
+
+    /**
+     * Enum describing how the rows of a PNG image are filtered before compression.
+     */
+    enum class PNGFilter {
+        /**
+         * Every row is stored unfiltered. It is the fastest to encode and works best for images with few colors.
+         */
+        NONE,
+        SUB,
+        UP,
+        AVERAGE,
+        PAETH,
+        /**
+         * Each row uses the filter that gives the smallest sum of absolute differences, which is what most encoders do
+         * by default. It gives the smallest files for photographic images and costs about five times the filtering
+         * work.
+         */
+        ADAPTIVE
+    };
+
+}
+
+#endif //CYDER_PNGFILTER_H
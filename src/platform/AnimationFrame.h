@@ -52,6 +52,17 @@ namespace cyder {
          * @param handle The ID value returned by the call to AnimationFrame::Request() that requested the callback.
          */
         static void Cancel(unsigned long handle);
+
+        /**
+         * Marks whether the frame callbacks of the scripts are running. The deferred drawing they do is flushed right
+         * after them, so it does not need to request a frame of its own.
+         */
+        static void SetInFrameUpdate(bool value);
+
+        /**
+         * Returns true while the frame callbacks of the scripts are running.
+         */
+        static bool InFrameUpdate();
     };
 
 
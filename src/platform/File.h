@@ -0,0 +1,69 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_FILE_H
+#define CYDER_FILE_H
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace cyder {
+
+    class File {
+    public:
+        /**
+         * Returns the last modification time of the file in nanoseconds since the epoch, or -1 if the file does not
+         * exist.
+         */
+        static int64_t ModificationTime(const std::string& path);
+
+        /**
+         * Returns the size of the file in bytes, or -1 if the file does not exist.
+         */
+        static int64_t Size(const std::string& path);
+
+        /**
+         * Creates the directory and any missing parent directories. Returns true if the directory exists afterwards.
+         */
+        static bool CreateDirectories(const std::string& path);
+
+        /**
+         * Returns the names of the regular files in the directory.
+         */
+        static std::vector<std::string> ListFiles(const std::string& directory);
+
+        /**
+         * Replaces the file at newPath with the file at oldPath atomically, so readers always see a complete file.
+         */
+        static bool Rename(const std::string& oldPath, const std::string& newPath);
+
+        static bool Remove(const std::string& path);
+    };
+
+}
+
+#endif //CYDER_FILE_H
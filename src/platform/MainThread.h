@@ -0,0 +1,53 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_MAINTHREAD_H
+#define CYDER_MAINTHREAD_H
+
+#include <functional>
+
+namespace cyder {
+
+    /**
+     * Delivers tasks to the main thread, the only thread allowed to touch the script engine.
+     */
+    class MainThread {
+    public:
+        /**
+         * Queues a task to run on the main thread. It is safe to call from any thread.
+         */
+        static void Post(const std::function<void()>& task);
+
+        /**
+         * Runs work on the shared thread pool, then runs callback on the main thread once the work is done. The
+         * application is kept running until the callback has been called.
+         */
+        static void PostBackgroundTask(const std::function<void()>& work, const std::function<void()>& callback);
+    };
+
+}
+
+#endif //CYDER_MAINTHREAD_H
@@ -0,0 +1,68 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_MAPPEDFILE_H
+#define CYDER_MAPPEDFILE_H
+
+#include <string>
+
+namespace cyder {
+
+    /**
+     * A whole file mapped into memory. The pages are loaded by the OS when they are first touched, so reading a file
+     * does not copy it into a heap buffer. The mapping is private and writable: a page is copied the first time it is
+     * written to, and the writes never reach the file.
+     */
+    class MappedFile {
+    public:
+        /**
+         * Maps the file at the specified path, returns nullptr if the file can not be opened or mapped.
+         */
+        static MappedFile* Open(const std::string& path);
+
+        ~MappedFile();
+
+        /**
+         * The first byte of the file, nullptr if the file is empty.
+         */
+        void* data() const {
+            return _data;
+        }
+
+        size_t size() const {
+            return _size;
+        }
+
+    private:
+        MappedFile(void* data, size_t size);
+
+        void* _data;
+        size_t _size;
+    };
+
+}
+
+#endif //CYDER_MAPPEDFILE_H
@@ -34,9 +34,20 @@ namespace cyder {
     public:
         static SkSurface* MakeGPU(int width, int height, bool transparent = true);
 
-        static SkSurface* MakeRaster(int width, int height, bool transparent = true) {
-            SkImageInfo info = SkImageInfo::MakeN32(width, height,
-                                                    transparent ? kPremul_SkAlphaType : kOpaque_SkAlphaType);
+        /**
+         * Creates a surface rendered by the CPU. Besides the native 32-bit type, Skia can only render into
+         * kRGB_565_SkColorType surfaces, which are always opaque, and kAlpha_8_SkColorType surfaces, which only keep
+         * the coverage of what is drawn.
+         */
+        static SkSurface* MakeRaster(int width, int height, bool transparent = true,
+                                     SkColorType colorType = kN32_SkColorType) {
+            auto alphaType = transparent ? kPremul_SkAlphaType : kOpaque_SkAlphaType;
+            if (colorType == kRGB_565_SkColorType) {
+                alphaType = kOpaque_SkAlphaType;
+            } else if (colorType == kAlpha_8_SkColorType) {
+                alphaType = kPremul_SkAlphaType;
+            }
+            SkImageInfo info = SkImageInfo::Make(width, height, colorType, alphaType);
             return SkSurface::MakeRaster(info).release();
         }
     };
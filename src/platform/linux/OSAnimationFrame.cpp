@@ -0,0 +1,111 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include <thread>
+#include "OSAnimationFrame.h"
+#include "OSApplication.h"
+#include "utils/GetTimer.h"
+
+namespace cyder {
+    size_t AnimationFrame::Request(FrameRequestCallback callback) {
+        return OSAnimationFrame::Request(callback);
+    }
+
+    void AnimationFrame::Cancel(size_t handle) {
+        OSAnimationFrame::Cancel(handle);
+    }
+
+    static bool inFrameUpdate = false;
+
+    void AnimationFrame::SetInFrameUpdate(bool value) {
+        inFrameUpdate = value;
+    }
+
+    bool AnimationFrame::InFrameUpdate() {
+        return inFrameUpdate;
+    }
+
+    // The interval used by the virtual clock when frames are produced as fast as possible.
+    static const double DEFAULT_FRAME_INTERVAL = 1000.0 / 60;
+
+    OSAnimationFrame* OSAnimationFrame::animationFrame = nullptr;
+
+    OSAnimationFrame::OSAnimationFrame(double frameRate, bool virtualClock) :
+            callbackList(new std::vector<FrameRequestCallback>()),
+            frameRate(frameRate > 0 ? frameRate : 0), virtualClock(virtualClock),
+            nextFrameTime(std::chrono::steady_clock::now()) {
+        animationFrame = this;
+    }
+
+    OSAnimationFrame::~OSAnimationFrame() {
+        delete callbackList;
+        animationFrame = nullptr;
+    }
+
+    void OSAnimationFrame::RunNextFrame() {
+        auto frame = animationFrame;
+        if (frame->frameRate > 0) {
+            auto interval = std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                    std::chrono::duration<double>(1.0 / frame->frameRate));
+            auto now = std::chrono::steady_clock::now();
+            if (frame->nextFrameTime > now) {
+                std::this_thread::sleep_until(frame->nextFrameTime);
+                frame->nextFrameTime += interval;
+            } else {
+                // We are running behind, skip the missed frames rather than trying to catch up.
+                frame->nextFrameTime = now + interval;
+            }
+        }
+        frame->update();
+    }
+
+    double OSAnimationFrame::nextTimestamp() {
+        if (!virtualClock) {
+            return GetTimer();
+        }
+        double interval = frameRate > 0 ? 1000.0 / frameRate : DEFAULT_FRAME_INTERVAL;
+        return frameCount * interval;
+    }
+
+    void OSAnimationFrame::update() {
+        if (!callbackList->empty()) {
+            std::vector<FrameRequestCallback> list;
+            callbackList->swap(list);
+            double timestamp = nextTimestamp();
+            for (const auto& callback : list) {
+                callback(timestamp);
+            }
+        }
+        frameCount++;
+        if (needUpdateScreen) {
+            needUpdateScreen = false;
+            auto app = static_cast<OSApplication*>(Application::application);
+            for (const auto& window : *(app->openedWindows())) {
+                window->screenBuffer()->present();
+            }
+        }
+    }
+}
@@ -0,0 +1,103 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_OSANIMATIONFRAME_H
+#define CYDER_OSANIMATIONFRAME_H
+
+#include <vector>
+#include <chrono>
+#include "platform/AnimationFrame.h"
+
+namespace cyder {
+
+    /**
+     * The headless animation frame driver. There is no display to synchronize with, so frames are produced by the
+     * application run loop, either as fast as possible or at a fixed rate.
+     */
+    class OSAnimationFrame {
+    public:
+        static void RequestScreenUpdate() {
+            animationFrame->needUpdateScreen = true;
+        }
+
+        static size_t Request(FrameRequestCallback callback) {
+            auto callbackList = animationFrame->callbackList;
+            auto handle = callbackList->size();
+            callbackList->push_back(callback);
+            return handle;
+        }
+
+        static void Cancel(size_t handle) {
+            auto callbackList = animationFrame->callbackList;
+            if (handle < callbackList->size()) {
+                callbackList->erase(callbackList->begin() + handle);
+            }
+        }
+
+        static void ForceScreenUpdateNow() {
+            animationFrame->needUpdateScreen = true;
+            animationFrame->update();
+        }
+
+        /**
+         * Returns true if there are frame callbacks or screen updates waiting for the next frame.
+         */
+        static bool HasNextFrame() {
+            return !animationFrame->callbackList->empty() || animationFrame->needUpdateScreen;
+        }
+
+        /**
+         * Blocks the calling thread until the next frame is due, then runs it.
+         */
+        static void RunNextFrame();
+
+        /**
+         * Creates the frame driver.
+         * @param frameRate The number of frames per second to produce. Pass 0 to produce frames as fast as possible.
+         * @param virtualClock If true, the timestamps passed to frame callbacks advance by exactly one frame interval
+         * per frame instead of following the wall clock, so that animations are reproducible regardless of how long
+         * each frame takes to render.
+         */
+        OSAnimationFrame(double frameRate = 60, bool virtualClock = false);
+        ~OSAnimationFrame();
+
+        void update();
+
+    private:
+        static OSAnimationFrame* animationFrame;
+
+        std::vector<FrameRequestCallback>* callbackList;
+        bool needUpdateScreen = false;
+        double frameRate;
+        bool virtualClock;
+        double frameCount = 0;
+        std::chrono::steady_clock::time_point nextFrameTime;
+
+        double nextTimestamp();
+    };
+}
+
+#endif  //CYDER_OSANIMATIONFRAME_H
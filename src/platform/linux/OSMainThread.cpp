@@ -0,0 +1,85 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "OSMainThread.h"
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include "utils/ThreadPool.h"
+
+namespace cyder {
+
+    static std::mutex locker;
+    static std::condition_variable condition;
+    static std::deque<std::function<void()>> taskQueue;
+    static int backgroundTaskCount = 0;
+
+    void MainThread::Post(const std::function<void()>& task) {
+        {
+            std::lock_guard<std::mutex> lock(locker);
+            taskQueue.push_back(task);
+        }
+        condition.notify_one();
+    }
+
+    void MainThread::PostBackgroundTask(const std::function<void()>& work, const std::function<void()>& callback) {
+        {
+            std::lock_guard<std::mutex> lock(locker);
+            backgroundTaskCount++;
+        }
+        ThreadPool::Shared()->post([=]() {
+            work();
+            {
+                std::lock_guard<std::mutex> lock(locker);
+                taskQueue.push_back(callback);
+                backgroundTaskCount--;
+            }
+            condition.notify_one();
+        });
+    }
+
+    bool OSMainThread::HasPendingTasks() {
+        std::lock_guard<std::mutex> lock(locker);
+        return !taskQueue.empty() || backgroundTaskCount > 0;
+    }
+
+    void OSMainThread::RunPendingTasks(bool wait) {
+        std::deque<std::function<void()>> tasks;
+        {
+            std::unique_lock<std::mutex> lock(locker);
+            if (wait) {
+                condition.wait(lock, [] {
+                    return !taskQueue.empty() || backgroundTaskCount == 0;
+                });
+            }
+            tasks.swap(taskQueue);
+        }
+        for (const auto& task : tasks) {
+            task();
+        }
+    }
+
+}
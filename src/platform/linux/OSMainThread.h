@@ -0,0 +1,54 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_OSMAINTHREAD_H
+#define CYDER_OSMAINTHREAD_H
+
+#include "platform/MainThread.h"
+
+namespace cyder {
+
+    /**
+     * The headless main thread queue. There is no native event loop, so the application run loop drains it between
+     * frames.
+     */
+    class OSMainThread {
+    public:
+        /**
+         * Returns true if there are tasks waiting to run or background tasks that will post a callback later.
+         */
+        static bool HasPendingTasks();
+
+        /**
+         * Runs all the tasks posted so far. If wait is true and there is nothing to run yet, blocks until a task
+         * arrives or no background task is left.
+         */
+        static void RunPendingTasks(bool wait = false);
+    };
+
+}
+
+#endif //CYDER_OSMAINTHREAD_H
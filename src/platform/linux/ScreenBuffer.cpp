@@ -0,0 +1,104 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "ScreenBuffer.h"
+#include "OSWindow.h"
+#include "OSAnimationFrame.h"
+#include "platform/SurfaceFactory.h"
+
+namespace cyder {
+
+    ScreenBuffer::ScreenBuffer(OSWindow* window, bool transparent) : window(window), transparent(transparent) {
+    }
+
+    ScreenBuffer::~ScreenBuffer() {
+        SkSafeUnref(_surface);
+    }
+
+    void ScreenBuffer::updateSize(int width, int height) {
+        if (!isValid) {
+            return;
+        }
+        _width = width;
+        _height = height;
+        invalidateSize();
+        damageAll();
+    }
+
+    void ScreenBuffer::setWidth(int value) {
+        if (!isValid || value < 0) {
+            return;
+        }
+        window->setContentSize(value / window->scaleFactor(), window->contentHeight());
+    }
+
+    void ScreenBuffer::setHeight(int value) {
+        if (!isValid || value < 0) {
+            return;
+        }
+        window->setContentSize(window->contentWidth(), value / window->scaleFactor());
+    }
+
+    SkCanvas* ScreenBuffer::getCanvas() {
+        if (!contentChanged) {
+            contentChanged = true;
+            OSAnimationFrame::RequestScreenUpdate();
+        }
+        return getSurface()->getCanvas();
+    }
+
+    void ScreenBuffer::draw(SkCanvas* canvas, SkScalar x, SkScalar y, const SkPaint* paint) {
+        getSurface()->draw(canvas, x, y, paint);
+    }
+
+    Image* ScreenBuffer::makeImageSnapshot() {
+        auto image = getSurface()->makeImageSnapshot().release();
+        return new Image(image);
+    }
+
+    bool ScreenBuffer::readPixels(const SkImageInfo& dstInfo, void* dstPixels, size_t dstRowBytes, int x, int y) {
+        return getSurface()->getCanvas()->readPixels(dstInfo, dstPixels, dstRowBytes, x, y);
+    }
+
+    SkSurface* ScreenBuffer::getSurface() {
+        if (_surface) {
+            return _surface;
+        }
+        _surface = SurfaceFactory::MakeRaster(_width, _height, transparent);
+        return _surface;
+    }
+
+    void ScreenBuffer::present() {
+        if (!isValid || !contentChanged) {
+            return;
+        }
+        contentChanged = false;
+        resetDamage();
+        _presentedFrames++;
+    }
+
+
+}  // namespace cyder
@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include <csignal>
+#include <cstdlib>
+#include <cstring>
+#include "OSApplication.h"
+#include "OSAnimationFrame.h"
+
+using namespace cyder;
+
+static const char* FRAME_RATE_FLAG = "--frame-rate=";
+static const char* VIRTUAL_CLOCK_FLAG = "--virtual-clock";
+
+/**
+ * Usage: cyder [--frame-rate=<fps>] [--virtual-clock] [v8 flags...]
+ * --frame-rate=<fps>   The number of frames to produce per second, 0 means as fast as possible. Defaults to 60.
+ * --virtual-clock      Advances the frame timestamps by exactly one frame interval per frame.
+ */
+int main(int argc, char* argv[]) {
+    signal(SIGPIPE, SIG_IGN);
+
+    double frameRate = 60;
+    bool virtualClock = false;
+    // Consume the platform flags so that they are not passed on to V8 and the scripts.
+    int count = 1;
+    for (int i = 1; i < argc; i++) {
+        auto arg = argv[i];
+        if (strncmp(arg, FRAME_RATE_FLAG, strlen(FRAME_RATE_FLAG)) == 0) {
+            frameRate = atof(arg + strlen(FRAME_RATE_FLAG));
+        } else if (strcmp(arg, VIRTUAL_CLOCK_FLAG) == 0) {
+            virtualClock = true;
+        } else {
+            argv[count++] = arg;
+        }
+    }
+    argv[count] = nullptr;
+
+    OSApplication app;
+    OSAnimationFrame animationFrame(frameRate, virtualClock);
+
+    return Start(count, argv);
+}
@@ -40,6 +40,16 @@ namespace cyder {
         OSAnimationFrame::Cancel(handle);
     }
 
+    static bool inFrameUpdate = false;
+
+    void AnimationFrame::SetInFrameUpdate(bool value) {
+        inFrameUpdate = value;
+    }
+
+    bool AnimationFrame::InFrameUpdate() {
+        return inFrameUpdate;
+    }
+
 
     OSAnimationFrame* OSAnimationFrame::animationFrame = nullptr;
 
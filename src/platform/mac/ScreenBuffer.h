@@ -81,6 +81,11 @@ namespace cyder {
 
         Image* makeImageSnapshot() override;
 
+        /**
+         * Reads from the surface directly, reading does not change the content, so it does not need a present.
+         */
+        bool readPixels(const SkImageInfo& dstInfo, void* dstPixels, size_t dstRowBytes, int x, int y) override;
+
         /**
          * Call to ensure all drawing to the surface has been applied to the Window.
          */
@@ -113,6 +118,7 @@ namespace cyder {
         bool isValid = true;
         int _width = 0;
         int _height = 0;
+        SkIRect previousDamage = SkIRect::MakeEmpty();
 
         SkSurface* getSurface();
 
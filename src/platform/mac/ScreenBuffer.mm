@@ -108,6 +108,7 @@ namespace cyder {
         _width = width;
         _height = height;
         invalidateSize();
+        damageAll();
     }
 
     void ScreenBuffer::setWidth(int value) {
@@ -119,6 +120,7 @@ namespace cyder {
         }
         invalidateSize();
         _width = value;
+        damageAll();
         window->setContentSize(_width, _height);
     }
 
@@ -128,6 +130,7 @@ namespace cyder {
         }
         invalidateSize();
         _height = value;
+        damageAll();
         window->setContentSize(_width, _height);
     }
 
@@ -148,6 +151,10 @@ namespace cyder {
         return new Image(image);
     }
 
+    bool ScreenBuffer::readPixels(const SkImageInfo& dstInfo, void* dstPixels, size_t dstRowBytes, int x, int y) {
+        return getSurface()->getCanvas()->readPixels(dstInfo, dstPixels, dstRowBytes, x, y);
+    }
+
     SkSurface* ScreenBuffer::getSurface() {
         if (_surface) {
             return _surface;
@@ -177,9 +184,23 @@ namespace cyder {
             glClear(GL_STENCIL_BUFFER_BIT);
             [openGLContext update];
             _screen = SkSurface::MakeFromBackendRenderTarget(grContext, desc, nullptr).release();
+            // Both buffers of the new swap chain have undefined content.
+            previousDamage = SkIRect::MakeWH(_width, _height);
+        }
+        // The backbuffer holds the frame before the last one, so it misses the damage of the last frame too.
+        SkIRect clip = damageRect();
+        clip.join(previousDamage);
+        previousDamage = damageRect();
+        resetDamage();
+        if (clip.isEmpty()) {
+            // The content was changed without reporting any damage.
+            clip = SkIRect::MakeWH(_width, _height);
         }
         auto canvas = _screen->getCanvas();
+        canvas->save();
+        canvas->clipRect(SkRect::Make(clip));
         getSurface()->draw(canvas, 0, 0, nullptr);
+        canvas->restore();
         grContext->flush();
         [openGLContext flushBuffer];
     }
@@ -0,0 +1,96 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "platform/File.h"
+#include <cstdio>
+#include <cerrno>
+#include <dirent.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cyder {
+
+    int64_t File::ModificationTime(const std::string& path) {
+        struct stat status;
+        if (stat(path.c_str(), &status) != 0) {
+            return -1;
+        }
+#ifdef OS_MACOS
+        auto& time = status.st_mtimespec;
+#else
+        auto& time = status.st_mtim;
+#endif
+        return static_cast<int64_t>(time.tv_sec) * 1000000000 + time.tv_nsec;
+    }
+
+    int64_t File::Size(const std::string& path) {
+        struct stat status;
+        if (stat(path.c_str(), &status) != 0) {
+            return -1;
+        }
+        return static_cast<int64_t>(status.st_size);
+    }
+
+    bool File::CreateDirectories(const std::string& path) {
+        struct stat status;
+        if (stat(path.c_str(), &status) == 0) {
+            return S_ISDIR(status.st_mode);
+        }
+        auto end = path.find_last_not_of('/');
+        auto parentEnd = end == std::string::npos ? std::string::npos : path.rfind('/', end);
+        if (parentEnd != std::string::npos && parentEnd > 0 && !CreateDirectories(path.substr(0, parentEnd))) {
+            return false;
+        }
+        // Another process may have created it meanwhile.
+        return mkdir(path.c_str(), 0755) == 0 || errno == EEXIST;
+    }
+
+    std::vector<std::string> File::ListFiles(const std::string& directory) {
+        std::vector<std::string> names;
+        auto dir = opendir(directory.c_str());
+        if (!dir) {
+            return names;
+        }
+        while (auto entry = readdir(dir)) {
+            std::string name = entry->d_name;
+            struct stat status;
+            if (stat((directory + "/" + name).c_str(), &status) == 0 && S_ISREG(status.st_mode)) {
+                names.push_back(name);
+            }
+        }
+        closedir(dir);
+        return names;
+    }
+
+    bool File::Rename(const std::string& oldPath, const std::string& newPath) {
+        return rename(oldPath.c_str(), newPath.c_str()) == 0;
+    }
+
+    bool File::Remove(const std::string& path) {
+        return unlink(path.c_str()) == 0;
+    }
+
+}
@@ -152,8 +152,10 @@ namespace cyder {
 
 
     int Socket::send(const char* buffer, int length) {
+#ifdef SO_NOSIGPIPE
         static int value = 1;
         setsockopt(data->nativeHandle, SOL_SOCKET, SO_NOSIGPIPE, &value, sizeof(value));
+#endif
         ASSERT(length <= 0 || buffer != nullptr);
         if (!isValid()) {
             return 0;
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "ExternalMemory.h"
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
+namespace cyder {
+
+    static std::atomic<int64_t> pendingChange(0);
+
+    struct SharedBlock {
+        int references;
+        int64_t bytes;
+    };
+
+    static std::mutex blockLocker;
+    static std::unordered_map<const void*, SharedBlock> sharedBlocks;
+
+    void ExternalMemory::Adjust(int64_t bytes) {
+        pendingChange.fetch_add(bytes, std::memory_order_relaxed);
+    }
+
+    int64_t ExternalMemory::TakePendingChange() {
+        return pendingChange.exchange(0, std::memory_order_relaxed);
+    }
+
+    void ExternalMemory::Retain(const void* block, int64_t bytes) {
+        std::lock_guard<std::mutex> lock(blockLocker);
+        auto& sharedBlock = sharedBlocks[block];
+        sharedBlock.references++;
+        if (bytes > sharedBlock.bytes) {
+            Adjust(bytes - sharedBlock.bytes);
+            sharedBlock.bytes = bytes;
+        }
+    }
+
+    void ExternalMemory::Release(const void* block) {
+        std::lock_guard<std::mutex> lock(blockLocker);
+        auto result = sharedBlocks.find(block);
+        if (result == sharedBlocks.end()) {
+            return;
+        }
+        if (--result->second.references == 0) {
+            Adjust(-result->second.bytes);
+            sharedBlocks.erase(result);
+        }
+    }
+
+}
@@ -0,0 +1,66 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_EXTERNALMEMORY_H
+#define CYDER_EXTERNALMEMORY_H
+
+#include <cstdint>
+
+namespace cyder {
+
+    /**
+     * Tracks the native memory held by the objects exposed to scripts, such as image pixels and canvas surfaces, so
+     * that the garbage collector can be told about it. Native code may allocate on any thread, so the changes are only
+     * accumulated here, and the binding layer reports them to the script engine from the main thread.
+     */
+    class ExternalMemory {
+    public:
+        /**
+         * Records bytes allocated (positive) or freed (negative). Thread-safe.
+         */
+        static void Adjust(int64_t bytes);
+
+        /**
+         * Records a reference to a block of memory shared by several objects, such as the pixels behind many images.
+         * The block is counted once, with the largest size it was retained with, until every reference is released.
+         * Thread-safe.
+         */
+        static void Retain(const void* block, int64_t bytes);
+
+        /**
+         * Drops a reference recorded by Retain(), the block is counted as freed when it was the last one.
+         */
+        static void Release(const void* block);
+
+        /**
+         * Returns the change recorded since the last call, and starts recording again from zero.
+         */
+        static int64_t TakePendingChange();
+    };
+
+}
+
+#endif //CYDER_EXTERNALMEMORY_H
@@ -0,0 +1,74 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "Hash.h"
+#include <cstring>
+
+namespace cyder {
+
+    uint64_t Hash::Bytes(const void* bytes, size_t length, uint64_t seed) {
+        const uint64_t m = 0xc6a4a7935bd1e995ULL;
+        const int r = 47;
+        uint64_t h = seed ^ (length * m);
+        auto data = static_cast<const uint8_t*>(bytes);
+        auto end = data + (length & ~static_cast<size_t>(7));
+        while (data != end) {
+            uint64_t k;
+            // memcpy keeps unaligned reads well defined, compilers turn it into a single load.
+            memcpy(&k, data, sizeof(k));
+            data += 8;
+            k *= m;
+            k ^= k >> r;
+            k *= m;
+            h ^= k;
+            h *= m;
+        }
+        switch (length & 7) {
+            case 7:
+                h ^= static_cast<uint64_t>(data[6]) << 48;
+            case 6:
+                h ^= static_cast<uint64_t>(data[5]) << 40;
+            case 5:
+                h ^= static_cast<uint64_t>(data[4]) << 32;
+            case 4:
+                h ^= static_cast<uint64_t>(data[3]) << 24;
+            case 3:
+                h ^= static_cast<uint64_t>(data[2]) << 16;
+            case 2:
+                h ^= static_cast<uint64_t>(data[1]) << 8;
+            case 1:
+                h ^= static_cast<uint64_t>(data[0]);
+                h *= m;
+            default:
+                break;
+        }
+        h ^= h >> r;
+        h *= m;
+        h ^= h >> r;
+        return h;
+    }
+
+}
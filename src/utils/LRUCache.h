@@ -0,0 +1,140 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_LRUCACHE_H
+#define CYDER_LRUCACHE_H
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <functional>
+#include <utility>
+
+namespace cyder {
+
+    /**
+     * A cache that evicts the least recently used entries once the total cost of its entries exceeds the capacity.
+     * The cost of an entry defaults to 1, in which case the capacity is the maximum number of entries.
+     */
+    template<class K, class V, class Hash = std::hash<K>>
+    class LRUCache {
+    public:
+        explicit LRUCache(size_t capacity) : _capacity(capacity) {
+        }
+
+        size_t capacity() const {
+            return _capacity;
+        }
+
+        /**
+         * Changes the capacity, evicting entries if the cache now exceeds it.
+         */
+        void setCapacity(size_t capacity) {
+            _capacity = capacity;
+            evict();
+        }
+
+        /**
+         * The total cost of all entries in the cache.
+         */
+        size_t totalCost() const {
+            return _totalCost;
+        }
+
+        size_t size() const {
+            return entries.size();
+        }
+
+        /**
+         * Returns the value for the key and marks it as the most recently used, or nullptr if the key is not cached.
+         */
+        V* find(const K& key) {
+            auto result = index.find(key);
+            if (result == index.end()) {
+                return nullptr;
+            }
+            entries.splice(entries.begin(), entries, result->second);
+            return &result->second->value;
+        }
+
+        /**
+         * Adds or replaces the value for the key, then evicts the least recently used entries until the total cost
+         * fits in the capacity again. The new entry itself is never evicted by this call. Returns the cached value.
+         */
+        V* insert(const K& key, V value, size_t cost = 1) {
+            remove(key);
+            entries.push_front(Entry{key, std::move(value), cost});
+            index[key] = entries.begin();
+            _totalCost += cost;
+            evict();
+            return &entries.front().value;
+        }
+
+        /**
+         * Removes the entry for the key. Returns false if the key is not cached.
+         */
+        bool remove(const K& key) {
+            auto result = index.find(key);
+            if (result == index.end()) {
+                return false;
+            }
+            _totalCost -= result->second->cost;
+            entries.erase(result->second);
+            index.erase(result);
+            return true;
+        }
+
+        void clear() {
+            index.clear();
+            entries.clear();
+            _totalCost = 0;
+        }
+
+    private:
+        struct Entry {
+            K key;
+            V value;
+            size_t cost;
+        };
+
+        size_t _capacity;
+        size_t _totalCost = 0;
+        std::list<Entry> entries;
+        std::unordered_map<K, typename std::list<Entry>::iterator, Hash> index;
+
+        void evict() {
+            while (_totalCost > _capacity && entries.size() > 1) {
+                auto& entry = entries.back();
+                _totalCost -= entry.cost;
+                index.erase(entry.key);
+                entries.pop_back();
+            }
+        }
+    };
+
+}
+
+#endif //CYDER_LRUCACHE_H
@@ -0,0 +1,347 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "PixelConversion.h"
+#include <cstdint>
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define CYDER_PIXEL_X86
+#include <immintrin.h>
+#elif defined(__aarch64__)
+#define CYDER_PIXEL_NEON
+#include <arm_neon.h>
+#endif
+
+namespace cyder {
+
+    // A kernel converts as many leading pixels as it can and returns how many it converted, the rest are left to the
+    // portable code.
+    typedef size_t (* ConvertKernel)(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB);
+
+    struct Kernels {
+        ConvertKernel premultiply;
+        ConvertKernel unpremultiply;
+    };
+
+    //==================================== Portable ====================================
+
+    static inline uint8_t MulDiv255Round(unsigned value, unsigned alpha) {
+        unsigned product = value * alpha + 128;
+        return static_cast<uint8_t>((product + (product >> 8)) >> 8);
+    }
+
+    static inline uint8_t DivideByAlpha(unsigned value, float scale) {
+        float result = static_cast<float>(value) * scale + 0.5f;
+        return result >= 255.0f ? static_cast<uint8_t>(255) : static_cast<uint8_t>(result);
+    }
+
+    static size_t PremultiplyPortable(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        int red = swapRB ? 2 : 0;
+        int blue = 2 - red;
+        for (size_t i = 0; i < count; i++) {
+            uint8_t r = src[red];
+            uint8_t g = src[1];
+            uint8_t b = src[blue];
+            uint8_t a = src[3];
+            dst[0] = MulDiv255Round(r, a);
+            dst[1] = MulDiv255Round(g, a);
+            dst[2] = MulDiv255Round(b, a);
+            dst[3] = a;
+            src += 4;
+            dst += 4;
+        }
+        return count;
+    }
+
+    static size_t UnpremultiplyPortable(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        int red = swapRB ? 2 : 0;
+        int blue = 2 - red;
+        for (size_t i = 0; i < count; i++) {
+            uint8_t r = src[red];
+            uint8_t g = src[1];
+            uint8_t b = src[blue];
+            uint8_t a = src[3];
+            // The same single precision division the vector kernels use, so every path gives identical results.
+            float scale = a ? 255.0f / static_cast<float>(a) : 0.0f;
+            dst[0] = DivideByAlpha(r, scale);
+            dst[1] = DivideByAlpha(g, scale);
+            dst[2] = DivideByAlpha(b, scale);
+            dst[3] = a;
+            src += 4;
+            dst += 4;
+        }
+        return count;
+    }
+
+#ifdef CYDER_PIXEL_X86
+
+    //==================================== SSE2 ====================================
+
+#define CYDER_SSE2 __attribute__((target("sse2")))
+#define CYDER_AVX2 __attribute__((target("avx2")))
+
+    CYDER_SSE2 static inline __m128i PremultiplyLanesSSE2(__m128i lanes, bool swapRB) {
+        if (swapRB) {
+            lanes = _mm_shufflelo_epi16(lanes, _MM_SHUFFLE(3, 0, 1, 2));
+            lanes = _mm_shufflehi_epi16(lanes, _MM_SHUFFLE(3, 0, 1, 2));
+        }
+        // Multiply the alpha lanes by 255 so that they come out unchanged.
+        const __m128i alphaLanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+        const __m128i alphaOne = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+        __m128i alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(lanes, 0xFF), 0xFF);
+        alpha = _mm_or_si128(_mm_andnot_si128(alphaLanes, alpha), alphaOne);
+        __m128i product = _mm_add_epi16(_mm_mullo_epi16(lanes, alpha), _mm_set1_epi16(128));
+        return _mm_srli_epi16(_mm_add_epi16(product, _mm_srli_epi16(product, 8)), 8);
+    }
+
+    CYDER_SSE2 static size_t PremultiplySSE2(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+            __m128i low = PremultiplyLanesSSE2(_mm_unpacklo_epi8(pixels, zero), swapRB);
+            __m128i high = PremultiplyLanesSSE2(_mm_unpackhi_epi8(pixels, zero), swapRB);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), _mm_packus_epi16(low, high));
+        }
+        return i;
+    }
+
+    CYDER_SSE2 static inline __m128i UnpremultiplyPixelSSE2(__m128i pixel, bool swapRB) {
+        __m128 values = _mm_cvtepi32_ps(pixel);
+        if (swapRB) {
+            values = _mm_shuffle_ps(values, values, _MM_SHUFFLE(3, 0, 1, 2));
+        }
+        __m128 alpha = _mm_shuffle_ps(values, values, _MM_SHUFFLE(3, 3, 3, 3));
+        __m128 scale = _mm_div_ps(_mm_set1_ps(255.0f), alpha);
+        scale = _mm_and_ps(scale, _mm_cmpneq_ps(alpha, _mm_setzero_ps()));
+        // Keep the alpha lane by scaling it by one.
+        const __m128 colorLanes = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+        scale = _mm_or_ps(_mm_and_ps(scale, colorLanes), _mm_andnot_ps(colorLanes, _mm_set1_ps(1.0f)));
+        return _mm_cvttps_epi32(_mm_add_ps(_mm_mul_ps(values, scale), _mm_set1_ps(0.5f)));
+    }
+
+    CYDER_SSE2 static size_t UnpremultiplySSE2(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        const __m128i zero = _mm_setzero_si128();
+        size_t i = 0;
+        for (; i + 4 <= count; i += 4) {
+            __m128i pixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i * 4));
+            __m128i low = _mm_unpacklo_epi8(pixels, zero);
+            __m128i high = _mm_unpackhi_epi8(pixels, zero);
+            __m128i p0 = UnpremultiplyPixelSSE2(_mm_unpacklo_epi16(low, zero), swapRB);
+            __m128i p1 = UnpremultiplyPixelSSE2(_mm_unpackhi_epi16(low, zero), swapRB);
+            __m128i p2 = UnpremultiplyPixelSSE2(_mm_unpacklo_epi16(high, zero), swapRB);
+            __m128i p3 = UnpremultiplyPixelSSE2(_mm_unpackhi_epi16(high, zero), swapRB);
+            // Both packs saturate, which clamps invalid premultiplied colors to 255.
+            __m128i result = _mm_packus_epi16(_mm_packs_epi32(p0, p1), _mm_packs_epi32(p2, p3));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 4), result);
+        }
+        return i;
+    }
+
+    //==================================== AVX2 ====================================
+
+    CYDER_AVX2 static inline __m256i PremultiplyLanesAVX2(__m256i lanes, bool swapRB) {
+        if (swapRB) {
+            lanes = _mm256_shufflelo_epi16(lanes, _MM_SHUFFLE(3, 0, 1, 2));
+            lanes = _mm256_shufflehi_epi16(lanes, _MM_SHUFFLE(3, 0, 1, 2));
+        }
+        const __m256i alphaLanes = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+        const __m256i alphaOne = _mm256_set_epi16(255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0, 255, 0, 0, 0);
+        __m256i alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(lanes, 0xFF), 0xFF);
+        alpha = _mm256_or_si256(_mm256_andnot_si256(alphaLanes, alpha), alphaOne);
+        __m256i product = _mm256_add_epi16(_mm256_mullo_epi16(lanes, alpha), _mm256_set1_epi16(128));
+        return _mm256_srli_epi16(_mm256_add_epi16(product, _mm256_srli_epi16(product, 8)), 8);
+    }
+
+    CYDER_AVX2 static size_t PremultiplyAVX2(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        const __m256i zero = _mm256_setzero_si256();
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            __m256i pixels = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i * 4));
+            // Unpacking and packing both work within 128-bit lanes, so the pixel order is preserved.
+            __m256i low = PremultiplyLanesAVX2(_mm256_unpacklo_epi8(pixels, zero), swapRB);
+            __m256i high = PremultiplyLanesAVX2(_mm256_unpackhi_epi8(pixels, zero), swapRB);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), _mm256_packus_epi16(low, high));
+        }
+        return i;
+    }
+
+    CYDER_AVX2 static inline __m256i UnpremultiplyPixelsAVX2(const uint8_t* src, bool swapRB) {
+        // Two pixels, one in each 128-bit lane.
+        __m128i pixels = _mm_loadl_epi64(reinterpret_cast<const __m128i*>(src));
+        __m256 values = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(pixels));
+        if (swapRB) {
+            values = _mm256_shuffle_ps(values, values, _MM_SHUFFLE(3, 0, 1, 2));
+        }
+        __m256 alpha = _mm256_shuffle_ps(values, values, _MM_SHUFFLE(3, 3, 3, 3));
+        __m256 scale = _mm256_div_ps(_mm256_set1_ps(255.0f), alpha);
+        scale = _mm256_and_ps(scale, _mm256_cmp_ps(alpha, _mm256_setzero_ps(), _CMP_NEQ_UQ));
+        scale = _mm256_blend_ps(scale, _mm256_set1_ps(1.0f), 0x88);
+        return _mm256_cvttps_epi32(_mm256_add_ps(_mm256_mul_ps(values, scale), _mm256_set1_ps(0.5f)));
+    }
+
+    CYDER_AVX2 static size_t UnpremultiplyAVX2(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            auto source = src + i * 4;
+            __m256i p01 = UnpremultiplyPixelsAVX2(source, swapRB);
+            __m256i p23 = UnpremultiplyPixelsAVX2(source + 8, swapRB);
+            __m256i p45 = UnpremultiplyPixelsAVX2(source + 16, swapRB);
+            __m256i p67 = UnpremultiplyPixelsAVX2(source + 24, swapRB);
+            // The packs leave the pixels as 0 2 4 6 in the low lane and 1 3 5 7 in the high lane.
+            __m256i packed = _mm256_packus_epi16(_mm256_packs_epi32(p01, p23), _mm256_packs_epi32(p45, p67));
+            packed = _mm256_permutevar8x32_epi32(packed, order);
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dst + i * 4), packed);
+        }
+        return i;
+    }
+
+    static Kernels SelectKernels() {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) {
+            return {PremultiplyAVX2, UnpremultiplyAVX2};
+        }
+        if (__builtin_cpu_supports("sse2")) {
+            return {PremultiplySSE2, UnpremultiplySSE2};
+        }
+        return {PremultiplyPortable, UnpremultiplyPortable};
+    }
+
+#elif defined(CYDER_PIXEL_NEON)
+
+    //==================================== NEON ====================================
+
+    static inline uint8x8_t MulDiv255RoundNEON(uint8x8_t value, uint8x8_t alpha) {
+        uint16x8_t product = vmull_u8(value, alpha);
+        // (product + ((product + 128) >> 8) + 128) >> 8, the same rounding as MulDiv255Round().
+        return vrshrn_n_u16(vrsraq_n_u16(product, product, 8), 8);
+    }
+
+    static inline uint8x16_t PremultiplyChannelNEON(uint8x16_t value, uint8x16_t alpha) {
+        return vcombine_u8(MulDiv255RoundNEON(vget_low_u8(value), vget_low_u8(alpha)),
+                           MulDiv255RoundNEON(vget_high_u8(value), vget_high_u8(alpha)));
+    }
+
+    static size_t PremultiplyNEON(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        size_t i = 0;
+        for (; i + 16 <= count; i += 16) {
+            uint8x16x4_t pixels = vld4q_u8(src + i * 4);
+            if (swapRB) {
+                uint8x16_t red = pixels.val[0];
+                pixels.val[0] = pixels.val[2];
+                pixels.val[2] = red;
+            }
+            pixels.val[0] = PremultiplyChannelNEON(pixels.val[0], pixels.val[3]);
+            pixels.val[1] = PremultiplyChannelNEON(pixels.val[1], pixels.val[3]);
+            pixels.val[2] = PremultiplyChannelNEON(pixels.val[2], pixels.val[3]);
+            vst4q_u8(dst + i * 4, pixels);
+        }
+        return i;
+    }
+
+    static inline uint16x4_t DivideByAlphaNEON(uint16x4_t value, float32x4_t scale) {
+        float32x4_t result = vaddq_f32(vmulq_f32(vcvtq_f32_u32(vmovl_u16(value)), scale), vdupq_n_f32(0.5f));
+        return vqmovn_u32(vcvtq_u32_f32(result));
+    }
+
+    static inline uint8x8_t UnpremultiplyChannelNEON(uint8x8_t value, float32x4_t lowScale, float32x4_t highScale) {
+        uint16x8_t wide = vmovl_u8(value);
+        uint16x4_t low = DivideByAlphaNEON(vget_low_u16(wide), lowScale);
+        uint16x4_t high = DivideByAlphaNEON(vget_high_u16(wide), highScale);
+        return vqmovn_u16(vcombine_u16(low, high));
+    }
+
+    static inline float32x4_t AlphaScaleNEON(uint16x4_t alpha) {
+        float32x4_t value = vcvtq_f32_u32(vmovl_u16(alpha));
+        float32x4_t scale = vdivq_f32(vdupq_n_f32(255.0f), value);
+        uint32x4_t transparent = vceqq_f32(value, vdupq_n_f32(0.0f));
+        return vreinterpretq_f32_u32(vbicq_u32(vreinterpretq_u32_f32(scale), transparent));
+    }
+
+    static size_t UnpremultiplyNEON(const uint8_t* src, uint8_t* dst, size_t count, bool swapRB) {
+        size_t i = 0;
+        for (; i + 8 <= count; i += 8) {
+            uint8x8x4_t pixels = vld4_u8(src + i * 4);
+            if (swapRB) {
+                uint8x8_t red = pixels.val[0];
+                pixels.val[0] = pixels.val[2];
+                pixels.val[2] = red;
+            }
+            uint16x8_t alpha = vmovl_u8(pixels.val[3]);
+            float32x4_t lowScale = AlphaScaleNEON(vget_low_u16(alpha));
+            float32x4_t highScale = AlphaScaleNEON(vget_high_u16(alpha));
+            pixels.val[0] = UnpremultiplyChannelNEON(pixels.val[0], lowScale, highScale);
+            pixels.val[1] = UnpremultiplyChannelNEON(pixels.val[1], lowScale, highScale);
+            pixels.val[2] = UnpremultiplyChannelNEON(pixels.val[2], lowScale, highScale);
+            vst4_u8(dst + i * 4, pixels);
+        }
+        return i;
+    }
+
+    static Kernels SelectKernels() {
+        // NEON is part of the base AArch64 instruction set.
+        return {PremultiplyNEON, UnpremultiplyNEON};
+    }
+
+#else
+
+    static Kernels SelectKernels() {
+        return {PremultiplyPortable, UnpremultiplyPortable};
+    }
+
+#endif
+
+    static const Kernels& GetKernels() {
+        static const Kernels kernels = SelectKernels();
+        return kernels;
+    }
+
+    void PixelConversion::Premultiply(const void* src, void* dst, size_t count, bool swapRB) {
+        auto source = static_cast<const uint8_t*>(src);
+        auto target = static_cast<uint8_t*>(dst);
+        auto done = GetKernels().premultiply(source, target, count, swapRB);
+        PremultiplyPortable(source + done * 4, target + done * 4, count - done, swapRB);
+    }
+
+    void PixelConversion::Unpremultiply(const void* src, void* dst, size_t count, bool swapRB) {
+        auto source = static_cast<const uint8_t*>(src);
+        auto target = static_cast<uint8_t*>(dst);
+        auto done = GetKernels().unpremultiply(source, target, count, swapRB);
+        UnpremultiplyPortable(source + done * 4, target + done * 4, count - done, swapRB);
+    }
+
+    void PixelConversion::SwapRB(const void* src, void* dst, size_t count) {
+        auto source = static_cast<const uint32_t*>(src);
+        auto target = static_cast<uint32_t*>(dst);
+        // Simple enough for the compiler to vectorize on its own.
+        for (size_t i = 0; i < count; i++) {
+            uint32_t pixel = source[i];
+            target[i] = (pixel & 0xFF00FF00) | ((pixel & 0x00FF0000) >> 16) | ((pixel & 0x000000FF) << 16);
+        }
+    }
+
+}
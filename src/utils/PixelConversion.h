@@ -0,0 +1,72 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_PIXELCONVERSION_H
+#define CYDER_PIXELCONVERSION_H
+
+#include <cstddef>
+#include <skia.h>
+
+namespace cyder {
+
+    /**
+     * Converts 32-bit pixels between the unpremultiplied RGBA layout used by scripts and the premultiplied native
+     * layout used by Skia. The kernels are picked at runtime for the instruction sets the CPU supports (SSE2, AVX2 or
+     * NEON) and give the same results as the portable fallback. All the methods allow src and dst to be the same
+     * buffer.
+     */
+    class PixelConversion {
+    public:
+        /**
+         * Returns true if kN32_SkColorType stores the blue channel first, in which case the red and blue channels must
+         * be swapped when converting from or to RGBA.
+         */
+        static bool NativeIsBGRA() {
+            return kN32_SkColorType == kBGRA_8888_SkColorType;
+        }
+
+        /**
+         * Multiplies the color channels of unpremultiplied pixels by their alpha, rounding to nearest.
+         * @param swapRB If true, also swaps the red and blue channels.
+         */
+        static void Premultiply(const void* src, void* dst, size_t count, bool swapRB);
+
+        /**
+         * Divides the color channels of premultiplied pixels by their alpha, rounding to nearest. Fully transparent
+         * pixels become transparent black.
+         * @param swapRB If true, also swaps the red and blue channels.
+         */
+        static void Unpremultiply(const void* src, void* dst, size_t count, bool swapRB);
+
+        /**
+         * Swaps the red and blue channels, converting between RGBA and BGRA.
+         */
+        static void SwapRB(const void* src, void* dst, size_t count);
+    };
+
+}
+
+#endif //CYDER_PIXELCONVERSION_H
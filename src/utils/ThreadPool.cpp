@@ -0,0 +1,134 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#include "ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <memory>
+
+namespace cyder {
+
+    ThreadPool* ThreadPool::Shared() {
+        static ThreadPool pool(static_cast<int>(std::thread::hardware_concurrency()));
+        return &pool;
+    }
+
+    ThreadPool::ThreadPool(int threadCount) {
+        if (threadCount < 1) {
+            threadCount = 1;
+        }
+        for (int i = 0; i < threadCount; i++) {
+            threads.push_back(std::thread(&ThreadPool::run, this));
+        }
+    }
+
+    ThreadPool::~ThreadPool() {
+        {
+            std::lock_guard<std::mutex> lock(locker);
+            stopped = true;
+        }
+        condition.notify_all();
+        for (auto& thread : threads) {
+            thread.join();
+        }
+    }
+
+    void ThreadPool::post(const std::function<void()>& task) {
+        {
+            std::lock_guard<std::mutex> lock(locker);
+            tasks.push_back(task);
+        }
+        condition.notify_one();
+    }
+
+    void ThreadPool::run() {
+        while (true) {
+            std::function<void()> task;
+            {
+                std::unique_lock<std::mutex> lock(locker);
+                condition.wait(lock, [this] { return stopped || !tasks.empty(); });
+                if (tasks.empty()) {
+                    return;
+                }
+                task = std::move(tasks.front());
+                tasks.pop_front();
+            }
+            task();
+        }
+    }
+
+    namespace {
+        struct ParallelForState {
+            int count;
+            std::function<void(int)> task;
+            std::atomic<int> nextIndex;
+            int finished = 0;
+            std::mutex locker;
+            std::condition_variable condition;
+
+            ParallelForState(int count, const std::function<void(int)>& task) :
+                    count(count), task(task), nextIndex(0) {
+            }
+
+            // Processes indices until there are none left.
+            void run() {
+                int done = 0;
+                int index;
+                while ((index = nextIndex++) < count) {
+                    task(index);
+                    done++;
+                }
+                if (done > 0) {
+                    std::lock_guard<std::mutex> lock(locker);
+                    finished += done;
+                    if (finished == count) {
+                        condition.notify_all();
+                    }
+                }
+            }
+        };
+    }
+
+    void ThreadPool::parallelFor(int count, const std::function<void(int index)>& task) {
+        if (count <= 0) {
+            return;
+        }
+        if (count == 1) {
+            task(0);
+            return;
+        }
+        // The helpers may start after all the work is done, so they share the ownership of the state.
+        auto state = std::make_shared<ParallelForState>(count, task);
+        int helperCount = std::min(count, threadCount() + 1) - 1;
+        for (int i = 0; i < helperCount; i++) {
+            post([state] { state->run(); });
+        }
+        state->run();
+        std::unique_lock<std::mutex> lock(state->locker);
+        state->condition.wait(lock, [&state] { return state->finished == state->count; });
+    }
+
+}
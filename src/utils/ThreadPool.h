@@ -0,0 +1,83 @@
+//////////////////////////////////////////////////////////////////////////////////////
+//
+//  The MIT License (MIT)
+//
+//  Copyright (c) 2017-present, cyder.org
+//  All rights reserved.
+//
+//  Permission is hereby granted, free of charge, to any person obtaining a copy of
+//  this software and associated documentation files (the "Software"), to deal in the
+//  Software without restriction, including without limitation the rights to use, copy,
+//  modify, merge, publish, distribute, sublicense, and/or sell copies of the Software,
+//  and to permit persons to whom the Software is furnished to do so, subject to the
+//  following conditions:
+//
+//      The above copyright notice and this permission notice shall be included in all
+//      copies or substantial portions of the Software.
+//
+//  THE SOFTWARE IS PROVIDED *AS IS*, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED,
+//  INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A
+//  PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+//  HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION
+//  OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE
+//  SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+//
+//////////////////////////////////////////////////////////////////////////////////////
+
+#ifndef CYDER_THREADPOOL_H
+#define CYDER_THREADPOOL_H
+
+#include <functional>
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+
+namespace cyder {
+
+    /**
+     * A fixed set of worker threads executing tasks in the order they are posted.
+     */
+    class ThreadPool {
+    public:
+        /**
+         * Returns the pool shared by all CPU-bound work of the runtime. It has one thread for each hardware thread.
+         */
+        static ThreadPool* Shared();
+
+        explicit ThreadPool(int threadCount);
+
+        /**
+         * Waits for the queued tasks to finish and stops the worker threads.
+         */
+        ~ThreadPool();
+
+        int threadCount() const {
+            return static_cast<int>(threads.size());
+        }
+
+        /**
+         * Queues a task to run on one of the worker threads.
+         */
+        void post(const std::function<void()>& task);
+
+        /**
+         * Runs task(index) for every index in [0, count), spread over the worker threads and the calling thread.
+         * Returns once all the indices have been processed.
+         */
+        void parallelFor(int count, const std::function<void(int index)>& task);
+
+    private:
+        std::vector<std::thread> threads;
+        std::deque<std::function<void()>> tasks;
+        std::mutex locker;
+        std::condition_variable condition;
+        bool stopped = false;
+
+        void run();
+    };
+
+}
+
+#endif //CYDER_THREADPOOL_H